@@ -0,0 +1,156 @@
+#pragma once
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+//Repeated timing of benchmarks with warm-up runs and order statistics of samples, reported as JSON
+namespace benchmark {
+    struct Case {
+        std::string name;
+        //Parameters reported along with timings, like system, field and order
+        std::vector<std::pair<std::string, std::string>> parameters;
+        //Prepares inputs outside of timing and returns the measured action, which returns a result size
+        //(e.g. basis size) to check that all runs compute the same thing
+        std::function<std::function<size_t()>()> setup;
+        //Operations done by one run, micro-benchmarks run a batch to be measurable
+        size_t operations = 1;
+    };
+
+    struct Config {
+        size_t warmup = 1;
+        size_t repetitions = 5;
+        std::string filter;
+        std::string output;
+        //Benchmark specific flags with their default values
+        std::map<std::string, std::string> parameters;
+    };
+
+    //Reads --filter, --warmup, --repetitions, --output and --<parameter> flags, each followed by a value.
+    //Returns error message or nullptr.
+    inline const char* parse_flags(int argc, char** argv, Config* config) {
+        for (int i = 1; i < argc; i += 2) {
+            std::string flag = argv[i];
+            if (!flag.starts_with("--")) { return "Expected flag"; }
+            if (i + 1 == argc) { return "Expected flag value"; }
+            std::string key = flag.substr(2), value = argv[i + 1];
+            if (key == "filter") {
+                config->filter = value;
+            } else if (key == "warmup") {
+                config->warmup = std::stoul(value);
+            } else if (key == "repetitions") {
+                config->repetitions = std::max<size_t>(std::stoul(value), 1);
+            } else if (key == "output") {
+                config->output = value;
+            } else if (config->parameters.contains(key)) {
+                config->parameters[key] = value;
+            } else {
+                return "Unknown flag";
+            }
+        }
+        return nullptr;
+    }
+
+    struct Result {
+        const Case* benchmark;
+        size_t result_size;
+        //Seconds, sorted
+        std::vector<double> samples;
+
+        //Nearest-rank percentile, p in (0, 100]
+        double percentile(double p) const {
+            size_t rank = static_cast<size_t>(std::ceil(p / 100 * samples.size()));
+            return samples[std::clamp<size_t>(rank, 1, samples.size()) - 1];
+        }
+
+        double median() const {
+            size_t n = samples.size();
+            return n % 2 ? samples[n / 2] : (samples[n / 2 - 1] + samples[n / 2]) / 2;
+        }
+
+        double mean() const {
+            double sum = 0;
+            for (double sample : samples) { sum += sample; }
+            return sum / samples.size();
+        }
+    };
+
+    inline Result run(const Case& benchmark, const Config& config) {
+        assert(config.repetitions > 0);
+        Result result{&benchmark, 0, {}};
+        for (size_t i = 0; i < config.warmup + config.repetitions; ++i) {
+            auto action = benchmark.setup();
+            auto start = std::chrono::steady_clock::now();
+            size_t size = action();
+            std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+            assert((i == 0 || size == result.result_size) && "Runs of a benchmark must give the same result");
+            result.result_size = size;
+            if (i >= config.warmup) { result.samples.push_back(elapsed.count()); }
+        }
+        std::sort(result.samples.begin(), result.samples.end());
+        return result;
+    }
+
+    inline void write_json(std::ostream& os, const std::vector<Result>& results, const Config& config) {
+        auto flags = os.flags();
+        os << std::setprecision(9);
+        os << "{\n  \"context\": {\"compiler\": \"" << __VERSION__ << "\", \"asserts\": "
+#ifdef NDEBUG
+           << "false"
+#else
+           << "true"
+#endif
+           << ", \"warmup\": " << config.warmup << ", \"repetitions\": " << config.repetitions;
+        for (const auto& [key, value] : config.parameters) { os << ", \"" << key << "\": \"" << value << '"'; }
+        os << "},\n";
+        os << "  \"benchmarks\": [";
+        for (size_t i = 0; i < results.size(); ++i) {
+            const Result& result = results[i];
+            os << (i ? ",\n" : "\n") << "    {\"name\": \"" << result.benchmark->name << '"';
+            for (const auto& [key, value] : result.benchmark->parameters) {
+                os << ", \"" << key << "\": \"" << value << '"';
+            }
+            os << ", \"operations\": " << result.benchmark->operations
+               << ", \"median_ns_per_operation\": " << result.median() * 1e9 / result.benchmark->operations
+               << ", \"result_size\": " << result.result_size << ", \"min_s\": " << result.samples.front()
+               << ", \"median_s\": " << result.median() << ", \"mean_s\": " << result.mean()
+               << ", \"p90_s\": " << result.percentile(90) << ", \"p99_s\": " << result.percentile(99)
+               << ", \"max_s\": " << result.samples.back() << ", \"samples_s\": [";
+            for (size_t j = 0; j < result.samples.size(); ++j) { os << (j ? ", " : "") << result.samples[j]; }
+            os << "]}";
+        }
+        os << "\n  ]\n}\n";
+        os.flags(flags);
+    }
+
+    //Runs cases matching the filter with progress on stderr, then writes the report to output or stdout
+    inline void run_all(const std::vector<Case>& cases, const Config& config) {
+        std::vector<Result> results;
+        for (const auto& benchmark : cases) {
+            if (benchmark.name.find(config.filter) == std::string::npos) { continue; }
+            results.push_back(run(benchmark, config));
+            const auto& result = results.back();
+            if (benchmark.operations == 1) {
+                std::cerr << benchmark.name << ": median " << result.median() << " s, p90 " << result.percentile(90)
+                          << " s" << std::endl;
+            } else {
+                double scale = 1e9 / benchmark.operations;
+                std::cerr << benchmark.name << ": median " << result.median() * scale << " ns/op, p90 "
+                          << result.percentile(90) * scale << " ns/op" << std::endl;
+            }
+        }
+        if (config.output.empty()) {
+            write_json(std::cout, results, config);
+        } else {
+            std::ofstream out(config.output);
+            write_json(out, results, config);
+        }
+    }
+}// namespace benchmark
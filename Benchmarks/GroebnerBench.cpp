@@ -0,0 +1,184 @@
+#pragma GCC optimize("O2")
+
+#include "../Library/GroebnerTrace.h"
+#include "../Library/PackedMonomial.h"
+#include "BenchmarkRunner.h"
+#include "Systems.h"
+#include <memory>
+
+//Reduced Groebner bases of classical systems across fields and orders.
+//Usage: BenchGroebner [--filter substring] [--warmup n] [--repetitions n] [--output file.json]
+namespace {
+    using namespace std;
+
+    using Mod = Mint<int64_t, 998244353>;
+    using SmallMod = Mint<int64_t, 32003>;
+    using Rational = Fraction<int64_t>;
+    using Integral = Integer<int64_t>;
+
+    template<typename T>
+    struct Name;
+    template<>
+    struct Name<Mod> {
+        static constexpr const char* value = "mod998244353";
+    };
+    template<>
+    struct Name<SmallMod> {
+        static constexpr const char* value = "mod32003";
+    };
+    template<>
+    struct Name<Rational> {
+        static constexpr const char* value = "rational";
+    };
+    template<>
+    struct Name<Integral> {
+        static constexpr const char* value = "integer";
+    };
+    template<>
+    struct Name<MonomialOrders::Grevlex> {
+        static constexpr const char* value = "grevlex";
+    };
+    template<>
+    struct Name<MonomialOrders::Grlex> {
+        static constexpr const char* value = "grlex";
+    };
+    template<>
+    struct Name<MonomialOrders::Lex> {
+        static constexpr const char* value = "lex";
+    };
+
+    template<typename Coefficient, typename VariableOrder>
+    struct Name<Monomial<Coefficient, VariableOrder>> {
+        static constexpr const char* value = "map";
+    };
+    template<typename Coefficient, size_t kVariables, typename Exponent, PackedLayout kLayout, char kLetter>
+    struct Name<PackedMonomial<Coefficient, kVariables, Exponent, kLayout, kLetter>> {
+        static constexpr const char* value = "packed";
+    };
+
+    struct System {
+        string name;
+        int n;
+        vector<string> polynomials;
+    };
+
+    //Map-based monomials and full reduction are the defaults and aren't mentioned in case names
+    template<typename Coefficient, typename Order,
+             typename Monom = Monomial<Coefficient, VariableOrders::InverseAsciiOrder>>
+    void add_cases(vector<benchmark::Case>* cases, const vector<System>& systems, bool lazy_tails = false) {
+        using Polynom = Polynomial<Monom, Order>;
+        for (const auto& [name, n, polynomials] : systems) {
+            string field = Name<Coefficient>::value, order = Name<Order>::value, monomial = Name<Monom>::value;
+            string full_name = name + "-" + to_string(n) + "/" + field + "/" + order;
+            if (monomial != "map") { full_name += "/" + monomial; }
+            if (lazy_tails) { full_name += "/lazy-tails"; }
+            auto setup = [polynomials, lazy_tails]() -> function<size_t()> {
+                auto ideal = make_shared<Ideal<Polynom>>();
+                ideal->set_lazy_tail_reduction(lazy_tails);
+                for (const auto& s : polynomials) { ideal->insert(s); }
+                return [ideal] {
+                    ideal->make_reduced_groebner_basis();
+                    return ideal->size();
+                };
+            };
+            cases->push_back({full_name, {{"system", name}, {"n", to_string(n)}, {"field", field}, {"order", order},
+                                          {"monomial", monomial}, {"tails", lazy_tails ? "lazy" : "full"}},
+                              setup});
+        }
+    }
+
+    //Replay of a trace, which is learned once outside of the measured runs
+    template<typename Coefficient, typename Order>
+    void add_trace_cases(vector<benchmark::Case>* cases, const vector<System>& systems) {
+        using Polynom = Polynomial<Monomial<Coefficient, VariableOrders::InverseAsciiOrder>, Order>;
+        for (const auto& [name, n, polynomials] : systems) {
+            string field = Name<Coefficient>::value, order = Name<Order>::value;
+            auto trace = make_shared<optional<GroebnerTrace<Polynom>>>();
+            auto setup = [polynomials, trace]() -> function<size_t()> {
+                auto ideal = make_shared<Ideal<Polynom>>();
+                for (const auto& s : polynomials) { ideal->insert(s); }
+                if (!*trace) {
+                    Ideal<Polynom> learning = *ideal;
+                    *trace = GroebnerTrace<Polynom>::learn(&learning);
+                }
+                return [ideal, trace] {
+                    (*trace)->replay(ideal.get());
+                    return ideal->size();
+                };
+            };
+            cases->push_back({name + "-" + to_string(n) + "/" + field + "/" + order + "/trace-replay",
+                              {{"system", name}, {"n", to_string(n)}, {"field", field}, {"order", order},
+                               {"monomial", "map"}, {"tails", "full"}, {"trace", "replay"}},
+                              setup});
+        }
+    }
+
+    //Sizes are chosen to run in about a second at most. Lex is far slower than graded orders, and 64-bit fractions
+    //overflow on katsura and random systems, so those are benchmarked on small instances only.
+    vector<benchmark::Case> make_suite() {
+        vector<benchmark::Case> cases;
+        add_cases<Mod, MonomialOrders::Grevlex>(&cases, {{"cyclic", 4, systems::cyclic(4)},
+                                                         {"cyclic", 5, systems::cyclic(5)},
+                                                         {"katsura", 3, systems::katsura(3)},
+                                                         {"katsura", 4, systems::katsura(4)},
+                                                         {"katsura", 5, systems::katsura(5)},
+                                                         {"eco", 5, systems::eco(5)},
+                                                         {"eco", 6, systems::eco(6)},
+                                                         {"noon", 3, systems::noon(3)},
+                                                         {"noon", 4, systems::noon(4)},
+                                                         {"random-dense-deg2", 3, systems::random_dense(3, 2)},
+                                                         {"random-dense-deg2", 4, systems::random_dense(4, 2)},
+                                                         {"random-dense-deg3", 3, systems::random_dense(3, 3)}});
+        add_cases<SmallMod, MonomialOrders::Grevlex>(&cases, {{"cyclic", 5, systems::cyclic(5)},
+                                                              {"katsura", 4, systems::katsura(4)},
+                                                              {"noon", 4, systems::noon(4)}});
+        add_cases<Mod, MonomialOrders::Grlex>(&cases, {{"cyclic", 4, systems::cyclic(4)},
+                                                       {"katsura", 4, systems::katsura(4)},
+                                                       {"eco", 5, systems::eco(5)},
+                                                       {"noon", 3, systems::noon(3)},
+                                                       {"random-dense-deg2", 3, systems::random_dense(3, 2)}});
+        add_cases<Mod, MonomialOrders::Lex>(&cases, {{"cyclic", 4, systems::cyclic(4)},
+                                                     {"katsura", 2, systems::katsura(2)},
+                                                     {"eco", 4, systems::eco(4)},
+                                                     {"noon", 2, systems::noon(2)},
+                                                     {"random-dense-deg2", 2, systems::random_dense(2, 2)}});
+        add_cases<Rational, MonomialOrders::Grevlex>(&cases, {{"cyclic", 4, systems::cyclic(4)},
+                                                              {"eco", 5, systems::eco(5)},
+                                                              {"noon", 3, systems::noon(3)}});
+        //Fraction-free computations over the integers
+        add_cases<Integral, MonomialOrders::Grevlex>(&cases, {{"cyclic", 4, systems::cyclic(4)},
+                                                              {"katsura", 3, systems::katsura(3)},
+                                                              {"eco", 5, systems::eco(5)},
+                                                              {"noon", 3, systems::noon(3)}});
+        //Variables x_0, ..., x_5 cover cyclic-5 and katsura-5
+        using PackedGrevlex = PackedMonomial<Mod, 6, uint8_t, PackedLayout::Grevlex>;
+        add_cases<Mod, MonomialOrders::Grevlex, PackedGrevlex>(&cases, {{"cyclic", 4, systems::cyclic(4)},
+                                                                       {"cyclic", 5, systems::cyclic(5)},
+                                                                       {"katsura", 4, systems::katsura(4)},
+                                                                       {"katsura", 5, systems::katsura(5)}});
+        add_cases<Mod, MonomialOrders::Grlex, PackedMonomial<Mod, 6>>(&cases, {{"katsura", 4, systems::katsura(4)}});
+        add_cases<Mod, MonomialOrders::Lex, PackedMonomial<Mod, 6>>(&cases, {{"cyclic", 4, systems::cyclic(4)}});
+        add_cases<Mod, MonomialOrders::Grevlex>(&cases,
+                                                {{"cyclic", 5, systems::cyclic(5)},
+                                                 {"katsura", 5, systems::katsura(5)},
+                                                 {"eco", 6, systems::eco(6)},
+                                                 {"noon", 4, systems::noon(4)}},
+                                                true);
+        add_cases<Mod, MonomialOrders::Grevlex, PackedGrevlex>(&cases, {{"katsura", 5, systems::katsura(5)}}, true);
+        add_trace_cases<Mod, MonomialOrders::Grevlex>(&cases, {{"cyclic", 5, systems::cyclic(5)},
+                                                               {"katsura", 5, systems::katsura(5)},
+                                                               {"eco", 6, systems::eco(6)},
+                                                               {"noon", 4, systems::noon(4)}});
+        add_trace_cases<Mod, MonomialOrders::Lex>(&cases, {{"cyclic", 4, systems::cyclic(4)}});
+        return cases;
+    }
+}// namespace
+
+int main(int argc, char** argv) {
+    benchmark::Config config;
+    if (const char* error = benchmark::parse_flags(argc, argv, &config)) {
+        cerr << error << endl;
+        return 1;
+    }
+    benchmark::run_all(make_suite(), config);
+}
@@ -0,0 +1,215 @@
+#pragma GCC optimize("O2")
+
+#include "../Library/Polynomial.h"
+#include "BenchmarkRunner.h"
+#include <memory>
+#include <random>
+
+//Monomial and polynomial primitives on random inputs, each case runs a batch of operations.
+//Usage: BenchKernels [--variables n] [--degree d] [--density p] [--terms t] [--batch b] [--seed s]
+//                    [--filter substring] [--warmup n] [--repetitions n] [--output file.json]
+//Every variable is present in a monomial with probability density and has degree from 1 to degree.
+namespace {
+    using namespace std;
+
+    using M = Mint<int64_t, 998244353>;
+    using Monom = Monomial<M, VariableOrders::InverseAsciiOrder>;
+    using Var = typename Monom::Variable_;
+
+    struct Parameters {
+        int variables;
+        int degree;
+        double density;
+        size_t terms;
+        size_t batch;
+        uint32_t seed;
+    };
+
+    class Generator {
+    public:
+        explicit Generator(const Parameters& parameters) : parameters_(parameters), rng_(parameters.seed) {}
+
+        Monom monomial() {
+            vector<pair<Var, int64_t>> variables;
+            bernoulli_distribution present(parameters_.density);
+            uniform_int_distribution<int64_t> degree(1, parameters_.degree);
+            for (int i = 0; i < parameters_.variables; ++i) {
+                if (present(rng_)) { variables.emplace_back(Var('x', i), degree(rng_)); }
+            }
+            sort(variables.begin(), variables.end());
+            uniform_int_distribution<int64_t> coefficient(1, 998244352);
+            return Monom(M(coefficient(rng_)), variables);
+        }
+
+        vector<Monom> monomials(size_t count) {
+            vector<Monom> res;
+            for (size_t i = 0; i < count; ++i) { res.push_back(monomial()); }
+            return res;
+        }
+
+        template<typename Polynom>
+        Polynom polynomial() {
+            Polynom res;
+            for (size_t i = 0; i < parameters_.terms; ++i) { res += monomial(); }
+            return res;
+        }
+
+    private:
+        Parameters parameters_;
+        mt19937 rng_;
+    };
+
+    template<typename T>
+    struct Name;
+    template<>
+    struct Name<MonomialOrders::Lex> {
+        static constexpr const char* value = "lex";
+    };
+    template<>
+    struct Name<MonomialOrders::Grlex> {
+        static constexpr const char* value = "grlex";
+    };
+    template<>
+    struct Name<MonomialOrders::Grevlex> {
+        static constexpr const char* value = "grevlex";
+    };
+
+    //Action gets generator seeded the same way for every run, so all runs work on equal inputs
+    template<typename Prepare>
+    benchmark::Case make_case(const string& kernel, const string& order, const Parameters& parameters,
+                              size_t operations, Prepare prepare) {
+        return {kernel + (order.empty() ? "" : "/" + order),
+                {{"kernel", kernel}, {"order", order}},
+                [parameters, prepare] {
+                    Generator generator(parameters);
+                    return prepare(generator);
+                },
+                operations};
+    }
+
+    template<typename Order>
+    void add_order_cases(vector<benchmark::Case>* cases, const Parameters& parameters) {
+        using Polynom = Polynomial<Monom, Order>;
+        string order = Name<Order>::value;
+        size_t batch = parameters.batch;
+        cases->push_back(make_case("monomial_compare", order, parameters, batch, [batch](Generator& generator) {
+            auto lhs = make_shared<vector<Monom>>(generator.monomials(batch));
+            auto rhs = make_shared<vector<Monom>>(generator.monomials(batch));
+            return function<size_t()>([lhs, rhs] {
+                Order order;
+                size_t less = 0;
+                for (size_t i = 0; i < lhs->size(); ++i) { less += order((*lhs)[i], (*rhs)[i]); }
+                return less;
+            });
+        }));
+        //Polynomials are smaller, so one run processes batch terms
+        size_t count = max<size_t>(batch / max<size_t>(parameters.terms, 1), 1);
+        auto polynomials = [count](Generator& generator) {
+            auto res = make_shared<vector<Polynom>>();
+            for (size_t i = 0; i < 2 * count; ++i) { res->push_back(generator.template polynomial<Polynom>()); }
+            return res;
+        };
+        cases->push_back(make_case("polynomial_add", order, parameters, count, [polynomials](Generator& generator) {
+            auto input = polynomials(generator);
+            return function<size_t()>([input] {
+                size_t terms = 0;
+                for (size_t i = 0; i < input->size(); i += 2) { terms += ((*input)[i] + (*input)[i + 1]).size(); }
+                return terms;
+            });
+        }));
+        cases->push_back(make_case("polynomial_sub", order, parameters, count, [polynomials](Generator& generator) {
+            auto input = polynomials(generator);
+            return function<size_t()>([input] {
+                size_t terms = 0;
+                for (size_t i = 0; i < input->size(); i += 2) { terms += ((*input)[i] - (*input)[i + 1]).size(); }
+                return terms;
+            });
+        }));
+        cases->push_back(make_case("s_polynomial", order, parameters, count, [polynomials](Generator& generator) {
+            auto input = polynomials(generator);
+            return function<size_t()>([input] {
+                size_t terms = 0;
+                for (size_t i = 0; i < input->size(); i += 2) {
+                    terms += get_S_polynomial((*input)[i], (*input)[i + 1]).size();
+                }
+                return terms;
+            });
+        }));
+    }
+
+    //Sums of degrees of results are returned to keep computations alive and compare runs
+    vector<benchmark::Case> make_suite(const Parameters& parameters) {
+        vector<benchmark::Case> cases;
+        size_t batch = parameters.batch;
+        auto pairs = [batch](Generator& generator) {
+            return make_pair(make_shared<vector<Monom>>(generator.monomials(batch)),
+                             make_shared<vector<Monom>>(generator.monomials(batch)));
+        };
+        cases.push_back(make_case("monomial_multiply", "", parameters, batch, [pairs](Generator& generator) {
+            auto [lhs, rhs] = pairs(generator);
+            return function<size_t()>([lhs, rhs] {
+                size_t degrees = 0;
+                for (size_t i = 0; i < lhs->size(); ++i) { degrees += ((*lhs)[i] * (*rhs)[i]).get_degree(); }
+                return degrees;
+            });
+        }));
+        cases.push_back(make_case("monomial_divide", "", parameters, batch, [pairs](Generator& generator) {
+            auto [lhs, rhs] = pairs(generator);
+            for (size_t i = 0; i < lhs->size(); ++i) { (*lhs)[i] *= (*rhs)[i]; }
+            return function<size_t()>([lhs, rhs] {
+                size_t degrees = 0;
+                for (size_t i = 0; i < lhs->size(); ++i) { degrees += ((*lhs)[i] / (*rhs)[i]).get_degree(); }
+                return degrees;
+            });
+        }));
+        cases.push_back(make_case("monomial_is_divisible", "", parameters, batch, [pairs](Generator& generator) {
+            auto [lhs, rhs] = pairs(generator);
+            //Half of pairs are divisible
+            for (size_t i = 0; i < lhs->size(); i += 2) { (*lhs)[i] *= (*rhs)[i]; }
+            return function<size_t()>([lhs, rhs] {
+                size_t divisible = 0;
+                for (size_t i = 0; i < lhs->size(); ++i) { divisible += (*lhs)[i].is_divisible_on((*rhs)[i]); }
+                return divisible;
+            });
+        }));
+        cases.push_back(make_case("monomial_gcd", "", parameters, batch, [pairs](Generator& generator) {
+            auto [lhs, rhs] = pairs(generator);
+            return function<size_t()>([lhs, rhs] {
+                size_t degrees = 0;
+                for (size_t i = 0; i < lhs->size(); ++i) { degrees += gcd((*lhs)[i], (*rhs)[i]).get_degree(); }
+                return degrees;
+            });
+        }));
+        cases.push_back(make_case("monomial_lcm", "", parameters, batch, [pairs](Generator& generator) {
+            auto [lhs, rhs] = pairs(generator);
+            return function<size_t()>([lhs, rhs] {
+                size_t degrees = 0;
+                for (size_t i = 0; i < lhs->size(); ++i) { degrees += lcm((*lhs)[i], (*rhs)[i]).get_degree(); }
+                return degrees;
+            });
+        }));
+        add_order_cases<MonomialOrders::Lex>(&cases, parameters);
+        add_order_cases<MonomialOrders::Grlex>(&cases, parameters);
+        add_order_cases<MonomialOrders::Grevlex>(&cases, parameters);
+        return cases;
+    }
+}// namespace
+
+int main(int argc, char** argv) {
+    benchmark::Config config;
+    config.parameters = {{"variables", "8"}, {"degree", "4"},       {"density", "0.5"},
+                         {"terms", "64"},    {"batch", "100000"}, {"seed", "777"}};
+    if (const char* error = benchmark::parse_flags(argc, argv, &config)) {
+        cerr << error << endl;
+        return 1;
+    }
+    const auto& flags = config.parameters;
+    Parameters parameters{stoi(flags.at("variables")),
+                          stoi(flags.at("degree")),
+                          stod(flags.at("density")),
+                          stoul(flags.at("terms")),
+                          stoul(flags.at("batch")),
+                          static_cast<uint32_t>(stoul(flags.at("seed")))};
+    assert(parameters.variables > 0 && parameters.degree > 0 && parameters.batch > 0);
+    benchmark::run_all(make_suite(parameters), config);
+}
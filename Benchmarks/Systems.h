@@ -0,0 +1,138 @@
+#pragma once
+#include <cstdint>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+//Classical benchmark systems in the text form accepted by Polynomial, so they can be built over any field.
+//Variables are x_1, ..., x_n (x_0, ..., x_n for katsura), all coefficients are integers.
+namespace systems {
+    namespace detail {
+        inline std::string var(int i) { return "x_" + std::to_string(i); }
+
+        inline void add_term(std::string* polynomial, int64_t coefficient, const std::string& monomial) {
+            if (coefficient == 0) { return; }
+            if (!polynomial->empty()) { *polynomial += coefficient < 0 ? " - " : " + "; }
+            if (polynomial->empty() && coefficient < 0) { *polynomial += "-"; }
+            uint64_t abs_coefficient = coefficient < 0 ? -coefficient : coefficient;
+            if (abs_coefficient != 1 || monomial.empty()) { *polynomial += std::to_string(abs_coefficient); }
+            *polynomial += monomial;
+        }
+    }// namespace detail
+
+    //Sums of all cyclic products of k consecutive variables, k < n, and x_1...x_n - 1
+    inline std::vector<std::string> cyclic(int n) {
+        std::vector<std::string> system;
+        for (int k = 1; k < n; ++k) {
+            std::string polynomial;
+            for (int i = 0; i < n; ++i) {
+                std::string monomial;
+                for (int t = 0; t < k; ++t) { monomial += detail::var((i + t) % n + 1); }
+                detail::add_term(&polynomial, 1, monomial);
+            }
+            system.push_back(polynomial);
+        }
+        std::string product;
+        for (int i = 1; i <= n; ++i) { product += detail::var(i); }
+        std::string polynomial;
+        detail::add_term(&polynomial, 1, product);
+        detail::add_term(&polynomial, -1, "");
+        system.push_back(polynomial);
+        return system;
+    }
+
+    //n + 1 variables u_0, ..., u_n: u_0 + 2(u_1 + ... + u_n) - 1 and sum of u_|l| u_|m - l| over l = -n..n equals u_m
+    //for m < n, where u_k = 0 for k > n
+    inline std::vector<std::string> katsura(int n) {
+        std::vector<std::string> system;
+        std::string linear;
+        detail::add_term(&linear, 1, detail::var(0));
+        for (int i = 1; i <= n; ++i) { detail::add_term(&linear, 2, detail::var(i)); }
+        detail::add_term(&linear, -1, "");
+        system.push_back(linear);
+        for (int m = 0; m < n; ++m) {
+            std::map<std::pair<int, int>, int64_t> coefficients;
+            for (int l = -n; l <= n; ++l) {
+                int a = std::abs(l), b = std::abs(m - l);
+                if (b > n) { continue; }
+                ++coefficients[{std::min(a, b), std::max(a, b)}];
+            }
+            std::string polynomial;
+            for (const auto& [vars, coefficient] : coefficients) {
+                const auto& [a, b] = vars;
+                std::string monomial = a == b ? detail::var(a) + "^2" : detail::var(a) + detail::var(b);
+                detail::add_term(&polynomial, coefficient, monomial);
+            }
+            detail::add_term(&polynomial, -1, detail::var(m));
+            system.push_back(polynomial);
+        }
+        return system;
+    }
+
+    //(x_k + x_1 x_{1 + k} + ... + x_{n - k - 1} x_{n - 1}) x_n - k for k < n, and x_1 + ... + x_{n - 1} + 1
+    inline std::vector<std::string> eco(int n) {
+        std::vector<std::string> system;
+        for (int k = 1; k < n; ++k) {
+            std::string polynomial;
+            detail::add_term(&polynomial, 1, detail::var(k) + detail::var(n));
+            for (int i = 1; i + k < n; ++i) {
+                detail::add_term(&polynomial, 1, detail::var(i) + detail::var(i + k) + detail::var(n));
+            }
+            detail::add_term(&polynomial, -k, "");
+            system.push_back(polynomial);
+        }
+        std::string linear;
+        for (int i = 1; i < n; ++i) { detail::add_term(&linear, 1, detail::var(i)); }
+        detail::add_term(&linear, 1, "");
+        system.push_back(linear);
+        return system;
+    }
+
+    //x_i (sum of x_j^2 over j != i) - 1.1 x_i + 1, multiplied by 10 to keep integer coefficients
+    inline std::vector<std::string> noon(int n) {
+        std::vector<std::string> system;
+        for (int i = 1; i <= n; ++i) {
+            std::string polynomial;
+            for (int j = 1; j <= n; ++j) {
+                if (j != i) { detail::add_term(&polynomial, 10, detail::var(i) + detail::var(j) + "^2"); }
+            }
+            detail::add_term(&polynomial, -11, detail::var(i));
+            detail::add_term(&polynomial, 10, "");
+            system.push_back(polynomial);
+        }
+        return system;
+    }
+
+    //n polynomials in n variables with all monomials of degree at most degree and random nonzero coefficients
+    inline std::vector<std::string> random_dense(int n, int degree, uint32_t seed = 777) {
+        std::vector<std::string> monomials;
+        std::vector<int> exponents(n + 1, 0);
+        //Enumerates exponent vectors with sum at most degree, exponents[n] takes the rest
+        auto enumerate = [&](auto&& self, int i, int left) -> void {
+            if (i == n) {
+                std::string monomial;
+                for (int j = 0; j < n; ++j) {
+                    if (exponents[j] == 1) { monomial += detail::var(j + 1); }
+                    if (exponents[j] > 1) { monomial += detail::var(j + 1) + "^" + std::to_string(exponents[j]); }
+                }
+                monomials.push_back(monomial);
+                return;
+            }
+            for (exponents[i] = 0; exponents[i] <= left; ++exponents[i]) { self(self, i + 1, left - exponents[i]); }
+        };
+        enumerate(enumerate, 0, degree);
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<int64_t> coefficient(-1000, 999);
+        std::vector<std::string> system;
+        for (int i = 0; i < n; ++i) {
+            std::string polynomial;
+            for (const auto& monomial : monomials) {
+                int64_t c = coefficient(rng);
+                detail::add_term(&polynomial, c < 0 ? c : c + 1, monomial);
+            }
+            system.push_back(polynomial);
+        }
+        return system;
+    }
+}// namespace systems
@@ -106,6 +106,10 @@ public:
         return res;
     }
 
+    //Fraction is kept in lowest terms with positive denominator
+    T get_numerator() const { return numerator_; }
+    T get_denominator() const { return denominator_; }
+
     friend std::ostream& operator<<(std::ostream& os, const Fraction& f) {
         if (f.denominator_ == 1) { return os << f.numerator_; }
         return os << std::string("\\frac{") << f.numerator_ << "}{" << f.denominator_ << "}";
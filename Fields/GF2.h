@@ -0,0 +1,62 @@
+#pragma once
+#include <cassert>
+#include <cstdint>
+#include <ostream>
+#include <type_traits>
+
+//Field of two elements stored in one byte. Addition is xor and multiplication is and, so unlike Mint<T, 2>
+//no operation needs reduction modulo 2.
+class GF2 {
+public:
+    GF2() = default;
+
+    template<typename U>
+    GF2(U value) : value_(value & 1) {
+        static_assert(std::is_integral_v<U> && std::is_signed_v<U>, "Numeric type must be signed and integral");
+    }
+
+    GF2& operator+=(const GF2& rhs) {
+        value_ ^= rhs.value_;
+        return *this;
+    }
+    friend GF2 operator+(GF2 lhs, const GF2& rhs) { return lhs += rhs; }
+
+    GF2& operator-=(const GF2& rhs) { return *this += rhs; }
+    friend GF2 operator-(GF2 lhs, const GF2& rhs) { return lhs -= rhs; }
+
+    GF2& operator*=(const GF2& rhs) {
+        value_ &= rhs.value_;
+        return *this;
+    }
+    friend GF2 operator*(GF2 lhs, const GF2& rhs) { return lhs *= rhs; }
+
+    GF2& operator/=(const GF2& rhs) {
+        assert(rhs.value_ && "Division by 0!");
+        return *this;
+    }
+    friend GF2 operator/(GF2 lhs, const GF2& rhs) { return lhs /= rhs; }
+
+    GF2 operator-() const { return *this; }
+
+    bool operator==(const GF2& rhs) const { return value_ == rhs.value_; }
+    friend bool operator!=(const GF2& lhs, const GF2& rhs) { return !(lhs == rhs); }
+    bool operator<(const GF2& rhs) const { return value_ < rhs.value_; }
+    friend bool operator>(const GF2& lhs, const GF2& rhs) { return rhs < lhs; }
+    friend bool operator<=(const GF2& lhs, const GF2& rhs) { return !(rhs < lhs); }
+    friend bool operator>=(const GF2& lhs, const GF2& rhs) { return !(lhs < rhs); }
+
+    void invert() { assert(value_ && "Attempt to invert 0."); }
+    friend GF2 invert(const GF2& rhs) {
+        GF2 res = rhs;
+        res.invert();
+        return res;
+    }
+
+    uint8_t get_value() const { return value_; }
+    static constexpr int64_t get_modulus() { return 2; }
+
+    friend std::ostream& operator<<(std::ostream& out, const GF2& rhs) { return out << int(rhs.value_); }
+
+private:
+    uint8_t value_ = 0;
+};
@@ -0,0 +1,84 @@
+#pragma once
+#include "Overflow.h"
+#include <cassert>
+#include <numeric>
+#include <ostream>
+#include <type_traits>
+
+//Ring of integers for fraction-free computations. Division is exact: divisor must divide the value,
+//e.g. content of a polynomial or gcd of two coefficients. Overflow raises overflow::flag(), see Overflow.h.
+template<typename T = int64_t>
+class Integer {
+    static_assert(std::is_integral_v<T> && std::is_signed_v<T>, "Numeric type must be signed and integral");
+
+public:
+    Integer() = default;
+
+    template<typename U>
+    Integer(U value) : value_(value) {
+        static_assert(std::is_integral_v<U> && std::is_signed_v<U>, "Numeric type must be signed and integral");
+    }
+
+    Integer& operator+=(const Integer& rhs) {
+        if (__builtin_add_overflow(value_, rhs.value_, &value_)) { overflow::raise(); }
+        return *this;
+    }
+    friend Integer operator+(Integer lhs, const Integer& rhs) { return lhs += rhs; }
+
+    Integer& operator-=(const Integer& rhs) {
+        if (__builtin_sub_overflow(value_, rhs.value_, &value_)) { overflow::raise(); }
+        return *this;
+    }
+    friend Integer operator-(Integer lhs, const Integer& rhs) { return lhs -= rhs; }
+
+    Integer& operator*=(const Integer& rhs) {
+        if (__builtin_mul_overflow(value_, rhs.value_, &value_)) { overflow::raise(); }
+        return *this;
+    }
+    friend Integer operator*(Integer lhs, const Integer& rhs) { return lhs *= rhs; }
+
+    Integer& operator/=(const Integer& rhs) {
+        assert(rhs.value_ != 0 && "Division by 0!");
+        assert(value_ % rhs.value_ == 0 && "Division must be exact");
+        value_ /= rhs.value_;
+        return *this;
+    }
+    friend Integer operator/(Integer lhs, const Integer& rhs) { return lhs /= rhs; }
+
+    Integer operator-() const {
+        Integer res;
+        if (__builtin_sub_overflow(T(0), value_, &res.value_)) { overflow::raise(); }
+        return res;
+    }
+
+    bool operator==(const Integer& rhs) const { return value_ == rhs.value_; }
+    friend bool operator!=(const Integer& lhs, const Integer& rhs) { return !(lhs == rhs); }
+    bool operator<(const Integer& rhs) const { return value_ < rhs.value_; }
+    friend bool operator>(const Integer& lhs, const Integer& rhs) { return rhs < lhs; }
+    friend bool operator<=(const Integer& lhs, const Integer& rhs) { return !(rhs < lhs); }
+    friend bool operator>=(const Integer& lhs, const Integer& rhs) { return !(lhs < rhs); }
+
+    //Non-negative, gcd(0, 0) = 0
+    friend Integer gcd(const Integer& lhs, const Integer& rhs) { return std::gcd(lhs.value_, rhs.value_); }
+
+    //Only units are invertible
+    void invert() { assert((value_ == 1 || value_ == -1) && "Only 1 and -1 are invertible"); }
+    friend Integer invert(const Integer& rhs) {
+        Integer res = rhs;
+        res.invert();
+        return res;
+    }
+
+    T get_value() const { return value_; }
+
+    friend std::ostream& operator<<(std::ostream& out, const Integer& rhs) { return out << rhs.value_; }
+
+private:
+    T value_ = 0;
+};
+
+template<typename>
+struct is_integer : std::false_type {};
+
+template<typename T>
+struct is_integer<Integer<T>> : std::true_type {};
@@ -89,6 +89,9 @@ public:
         return res;
     }
 
+    T get_value() const { return value_; }
+    static constexpr T get_modulus() { return MOD; }
+
     friend std::ostream& operator<<(std::ostream& out, const Mint& rhs) { return out << rhs.value_; }
 
 private:
@@ -113,3 +116,9 @@ private:
 
     T value_ = 0;
 };
+
+template<typename>
+struct is_mint : std::false_type {};
+
+template<typename T, const T MOD>
+struct is_mint<Mint<T, MOD>> : std::true_type {};
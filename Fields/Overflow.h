@@ -0,0 +1,18 @@
+#pragma once
+
+//Arithmetic that can't represent its result, like Integer coefficients or multiplication of packed monomials with
+//too large exponents, raises the overflow flag of the thread instead of failing, and the result is unspecified then.
+//Computations of Groebner bases reset the flag and stop with ComputationStatus::ArithmeticOverflow once it's raised.
+namespace overflow {
+    //Constant initialization keeps access to the thread-local flag free of initialization guards
+    inline bool& flag() {
+        constinit thread_local bool raised = false;
+        return raised;
+    }
+
+    inline void raise() { flag() = true; }
+
+    inline bool is_raised() { return flag(); }
+
+    inline void reset() { flag() = false; }
+}// namespace overflow
@@ -0,0 +1,130 @@
+#pragma once
+#include <cassert>
+#include <limits>
+#include <ostream>
+#include <type_traits>
+
+//Residues modulo a prime chosen at run time. The modulus is shared by all values of the type in the process,
+//so it must be set before any arithmetic and stay the same while any value is alive, e.g. in a worker process
+//computing modulo a single prime.
+template<typename T = int64_t>
+class RuntimeMint {
+    static_assert(std::is_integral_v<T> && std::is_signed_v<T>, "Numeric type must be signed and integral");
+
+public:
+    RuntimeMint() = default;
+
+    template<typename U>
+    RuntimeMint(U value) : value_(reduce(value)) {
+        static_assert(std::is_integral_v<U> && std::is_signed_v<U>, "Numeric type must be signed and integral");
+    }
+
+    //Modulus must be prime, inverses are computed by Fermat's little theorem
+    static void set_modulus(T modulus) {
+        assert(modulus > 1 && "Modulus must be greater than 1");
+        assert(std::numeric_limits<T>::max() / modulus > modulus && "Modulus^2 should fit in numeric type");
+        modulus_ = modulus;
+    }
+    static T get_modulus() { return modulus_; }
+
+    RuntimeMint& operator+=(const RuntimeMint& rhs) {
+        value_ += rhs.value_;
+        value_ -= value_ < modulus_ ? 0 : modulus_;
+        return *this;
+    }
+    friend RuntimeMint operator+(const RuntimeMint& lhs, const RuntimeMint& rhs) {
+        RuntimeMint res = lhs;
+        res += rhs;
+        return res;
+    }
+
+    RuntimeMint& operator-=(const RuntimeMint& rhs) {
+        value_ -= rhs.value_;
+        value_ += value_ < 0 ? modulus_ : 0;
+        return *this;
+    }
+    friend RuntimeMint operator-(const RuntimeMint& lhs, const RuntimeMint& rhs) {
+        RuntimeMint res = lhs;
+        res -= rhs;
+        return res;
+    }
+
+    RuntimeMint& operator*=(const RuntimeMint& rhs) {
+        value_ *= rhs.value_;
+        value_ %= modulus_;
+        return *this;
+    }
+    friend RuntimeMint operator*(const RuntimeMint& lhs, const RuntimeMint& rhs) {
+        RuntimeMint res = lhs;
+        res *= rhs;
+        return res;
+    }
+
+    RuntimeMint& operator/=(const RuntimeMint& rhs) {
+        assert(rhs.value_ != 0 && "Division by 0!");
+        value_ *= binpow(rhs.value_, modulus_ - 2);
+        value_ %= modulus_;
+        return *this;
+    }
+    friend RuntimeMint operator/(const RuntimeMint& lhs, const RuntimeMint& rhs) {
+        RuntimeMint res = lhs;
+        res /= rhs;
+        return res;
+    }
+
+    RuntimeMint operator-() const {
+        RuntimeMint res;
+        res.value_ = value_ ? modulus_ - value_ : 0;
+        return res;
+    }
+
+    bool operator==(const RuntimeMint& rhs) const { return value_ == rhs.value_; }
+    friend bool operator!=(const RuntimeMint& lhs, const RuntimeMint& rhs) { return !(lhs == rhs); }
+    bool operator<(const RuntimeMint& rhs) const { return value_ < rhs.value_; }
+    friend bool operator>(const RuntimeMint& lhs, const RuntimeMint& rhs) { return rhs < lhs; }
+    friend bool operator<=(const RuntimeMint& lhs, const RuntimeMint& rhs) { return !(rhs < lhs); }
+    friend bool operator>=(const RuntimeMint& lhs, const RuntimeMint& rhs) { return !(lhs < rhs); }
+
+    void pow(T power) { value_ = binpow(value_, power); }
+    friend RuntimeMint pow(const RuntimeMint& rhs, T power) {
+        RuntimeMint res = rhs;
+        res.pow(power);
+        return res;
+    }
+
+    void invert() {
+        assert(value_ && "Attempt to invert 0.");
+        value_ = binpow(value_, modulus_ - 2);
+    }
+    friend RuntimeMint invert(const RuntimeMint& rhs) {
+        RuntimeMint res = rhs;
+        res.invert();
+        return res;
+    }
+
+    T get_value() const { return value_; }
+
+    friend std::ostream& operator<<(std::ostream& out, const RuntimeMint& rhs) { return out << rhs.value_; }
+
+private:
+    static T binpow(T val, T pow) {
+        if (pow < 0) { return binpow(binpow(val, modulus_ - 2), -pow); }
+        T res = 1;
+        for (T x = val; pow; pow >>= 1) {
+            if (pow & 1) { res = res * x % modulus_; }
+            x = x * x % modulus_;
+        }
+        return res;
+    }
+
+    template<typename U>
+    static T reduce(U c) {
+        assert(modulus_ > 1 && "Modulus isn't set");
+        using C = std::common_type_t<T, U>;
+        T res = static_cast<T>(static_cast<C>(c) % static_cast<C>(modulus_));
+        return res < 0 ? res + modulus_ : res;
+    }
+
+    static inline T modulus_ = 0;
+    T value_ = 0;
+};
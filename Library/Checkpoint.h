@@ -0,0 +1,82 @@
+#pragma once
+#include "Serialization.h"
+#include <cstdio>
+
+//Checkpoints of long make_groebner_basis runs. File holds the current basis in serialization format
+//followed by the position of Buchberger's algorithm and its statistics, so the run resumes with the same pairs.
+namespace checkpoint {
+    struct Trailer {
+        uint64_t next_i;
+        uint64_t next_j;
+        uint64_t processed_pairs;
+        uint64_t coprime_pairs;
+        uint64_t zero_reductions;
+    };
+
+    template<typename Polynom>
+    void write(std::ostream& os, const Ideal<Polynom>& ideal) {
+        const auto& [next_i, next_j, statistics] = ideal.get_buchberger_state();
+        serialization::Codec<Polynom>::write(os, ideal.get_basis(), serialization::Kind::Checkpoint, BasisType::Any);
+        Trailer trailer{next_i, next_j, statistics.processed_pairs, statistics.coprime_pairs,
+                        statistics.zero_reductions};
+        os.write(reinterpret_cast<const char*>(&trailer), sizeof(trailer));
+    }
+
+    //Returns nullptr on success or error message, then ideal is left unchanged
+    template<typename Polynom>
+    const char* read(std::istream& is, Ideal<Polynom>* ideal) {
+        std::vector<Polynom> polynomials;
+        BasisType basis_type;
+        using Codec = serialization::Codec<Polynom>;
+        if (const char* error = Codec::read(is, serialization::Kind::Checkpoint, &polynomials, &basis_type)) {
+            return error;
+        }
+        Trailer trailer;
+        is.read(reinterpret_cast<char*>(&trailer), sizeof(trailer));
+        if (static_cast<size_t>(is.gcount()) != sizeof(trailer)) { return "Unexpected end of input"; }
+        if (trailer.next_i > polynomials.size() || (trailer.next_j >= trailer.next_i && trailer.next_j != 0)) {
+            return "Bad pair position";
+        }
+        typename Ideal<Polynom>::BuchbergerState state{
+                trailer.next_i,
+                trailer.next_j,
+                {trailer.processed_pairs, trailer.coprime_pairs, trailer.zero_reductions},
+        };
+        ideal->restore_buchberger_state(std::move(polynomials), state);
+        return nullptr;
+    }
+
+    //Writes to a temporary file first, so a crash while saving never damages the previous checkpoint.
+    //Returns nullptr on success or error message.
+    template<typename Polynom>
+    const char* save(const std::string& path, const Ideal<Polynom>& ideal) {
+        std::string temporary_path = path + ".tmp";
+        {
+            std::ofstream out(temporary_path, std::ios::binary);
+            if (!out) { return "Can't create file"; }
+            write(out, ideal);
+            if (!out.flush()) { return "Can't write file"; }
+        }
+        if (std::rename(temporary_path.c_str(), path.c_str()) != 0) { return "Can't replace previous checkpoint"; }
+        return nullptr;
+    }
+
+    template<typename Polynom>
+    const char* load(const std::string& path, Ideal<Polynom>* ideal) {
+        std::ifstream in(path, std::ios::binary);
+        if (!in) { return "Can't read file"; }
+        return read(in, ideal);
+    }
+
+    //Makes make_groebner_basis save its state to path according to policy. Failed saves are passed to on_error,
+    //which may stop the computation, e.g. through the stop token of the ideal, or let it go on to the next attempt.
+    template<typename Polynom>
+    void enable(Ideal<Polynom>* ideal, const std::string& path, typename Ideal<Polynom>::CheckpointPolicy policy,
+                std::function<void(const char*)> on_error) {
+        ideal->set_checkpoint_handler(
+                [path, on_error = std::move(on_error)](const Ideal<Polynom>& ideal) {
+                    if (const char* error = save(path, ideal)) { on_error(error); }
+                },
+                policy);
+    }
+}// namespace checkpoint
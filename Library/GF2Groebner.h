@@ -0,0 +1,171 @@
+#pragma once
+#include "../Fields/GF2.h"
+#include "GF2Matrix.h"
+#include "Ideal.h"
+#include <map>
+#include <set>
+
+//Groebner bases over GF(2) by matrix reduction (F4 style). Pairs of the lowest lcm degree are reduced together:
+//their multiples and multiples of basis polynomials that can reduce any appearing monomial form rows of a bit-packed
+//matrix, and its echelon form yields all new basis polynomials of the step at once.
+namespace gf2 {
+    struct Options {
+        //Computes in the Boolean ring, where x^2 = x for every variable, by adding field equations x^2 + x
+        bool boolean_ring = false;
+    };
+
+    template<typename Polynom>
+    class GroebnerBasisBuilder {
+        using Monom = typename Polynom::Monom_;
+        using Order = typename Polynom::MonomialOrder_;
+        using DegreeType = typename Monom::DegreeType_;
+        using Var = typename Monom::Variable_;
+        static_assert(std::is_same_v<typename Monom::CoefficientType_, GF2>, "Coefficients must be in GF2");
+
+        struct Pair {
+            size_t i;
+            size_t j;
+            Monom lcm;
+            DegreeType degree;
+        };
+
+        struct RowKey {
+            size_t index;
+            Monom leading;
+
+            bool operator<(const RowKey& rhs) const {
+                if (index != rhs.index) { return index < rhs.index; }
+                return Order()(leading, rhs.leading);
+            }
+        };
+
+    public:
+        std::vector<Polynom> build(const std::vector<Polynom>& generators, const Options& options) {
+            std::vector<Polynom> rows = generators;
+            if (options.boolean_ring) { add_field_equations(&rows); }
+            //Generators are interreduced as the first step, so that their leading monomials are distinct
+            for (auto& p : reduce_rows(rows, {})) { insert(std::move(p)); }
+            while (!pairs_.empty()) {
+                std::vector<Pair> selected = select_pairs();
+                std::set<RowKey> keys;
+                rows.clear();
+                for (const Pair& pair : selected) {
+                    for (size_t index : {pair.i, pair.j}) {
+                        Monom multiplier = pair.lcm / basis_[index].get_highest_monomial();
+                        if (keys.insert({index, pair.lcm}).second) { rows.push_back(basis_[index] * multiplier); }
+                    }
+                }
+                std::set<Monom, Order> leading;
+                for (const auto& row : rows) { leading.insert(row.get_highest_monomial()); }
+                add_reducers(&rows, &leading);
+                for (auto& p : reduce_rows(rows, leading)) { insert(std::move(p)); }
+            }
+            return std::move(basis_);
+        }
+
+    private:
+        static void add_field_equations(std::vector<Polynom>* polynomials) {
+            std::set<Var> variables;
+            for (const auto& p : *polynomials) {
+                for (const auto& m : p.get_monomials_ascending_order()) {
+                    for (const auto& [var, degree] : m.get_variables_ascending_order()) { variables.insert(var); }
+                }
+            }
+            for (const Var& var : variables) { polynomials->push_back(Polynom(Monom(1, var, 2)) + Monom(1, var, 1)); }
+        }
+
+        //Pairs of the lowest lcm degree, the normal selection strategy
+        std::vector<Pair> select_pairs() {
+            DegreeType degree = pairs_.front().degree;
+            for (const Pair& pair : pairs_) { degree = std::min(degree, pair.degree); }
+            std::vector<Pair> selected, rest;
+            for (auto& pair : pairs_) { (pair.degree == degree ? selected : rest).push_back(std::move(pair)); }
+            pairs_ = std::move(rest);
+            return selected;
+        }
+
+        //Symbolic preprocessing: every monomial divisible by a leading monomial of the basis gets a reducer row
+        void add_reducers(std::vector<Polynom>* rows, std::set<Monom, Order>* leading) {
+            std::set<Monom, Order> monomials;
+            for (const auto& row : *rows) {
+                for (const auto& m : row.get_monomials_ascending_order()) { monomials.insert(m); }
+            }
+            //Reducers only bring monomials smaller than the current one, which are visited later
+            for (auto it = monomials.rbegin(); it != monomials.rend(); ++it) {
+                if (leading->contains(*it)) { continue; }
+                const Polynom* reducer = find_reducer(*it);
+                if (!reducer) { continue; }
+                Polynom row = *reducer * (*it / reducer->get_highest_monomial());
+                for (const auto& m : row.get_monomials_ascending_order()) { monomials.insert(m); }
+                leading->insert(*it);
+                rows->push_back(std::move(row));
+            }
+        }
+
+        const Polynom* find_reducer(const Monom& m) const {
+            DegreeType degree = m.get_degree();
+            for (size_t i = 0; i < basis_.size(); ++i) {
+                if (leading_degrees_[i] <= degree && m.is_divisible_on(basis_[i].get_highest_monomial())) {
+                    return &basis_[i];
+                }
+            }
+            return nullptr;
+        }
+
+        //Echelon form of rows, returns its rows with leading monomials not in leading
+        static std::vector<Polynom> reduce_rows(const std::vector<Polynom>& rows,
+                                                const std::set<Monom, Order>& leading) {
+            std::map<Monom, size_t, Order> columns;
+            for (const auto& row : rows) {
+                for (const auto& m : row.get_monomials_ascending_order()) { columns.emplace(m, 0); }
+            }
+            //The highest monomial goes to the first column
+            std::vector<const Monom*> monomials;
+            for (auto it = columns.rbegin(); it != columns.rend(); ++it) {
+                it->second = monomials.size();
+                monomials.push_back(&it->first);
+            }
+            GF2Matrix matrix(rows.size(), monomials.size());
+            for (size_t i = 0; i < rows.size(); ++i) {
+                for (const auto& m : rows[i].get_monomials_ascending_order()) { matrix.flip(i, columns.at(m)); }
+            }
+            size_t rank = matrix.echelonize();
+            std::vector<Polynom> res;
+            for (size_t i = 0; i < rank; ++i) {
+                if (leading.contains(*monomials[matrix.get_leading_column(i)])) { continue; }
+                Polynom p;
+                for (size_t column = monomials.size(); column-- > 0;) {
+                    if (matrix.get(i, column)) { p.append_highest_monomial(Monom(*monomials[column])); }
+                }
+                res.push_back(std::move(p));
+            }
+            return res;
+        }
+
+        //Pairs with coprime leading monomials reduce to zero and are skipped
+        void insert(Polynom&& p) {
+            const Monom& leading = p.get_highest_monomial();
+            for (size_t i = 0; i < basis_.size(); ++i) {
+                const Monom& other = basis_[i].get_highest_monomial();
+                if (gcd(leading, other).get_degree() == 0) { continue; }
+                Monom pair_lcm = lcm(leading, other);
+                DegreeType degree = pair_lcm.get_degree();
+                pairs_.push_back({i, basis_.size(), std::move(pair_lcm), degree});
+            }
+            leading_degrees_.push_back(leading.get_degree());
+            basis_.push_back(std::move(p));
+        }
+
+        std::vector<Polynom> basis_;
+        std::vector<DegreeType> leading_degrees_;
+        std::vector<Pair> pairs_;
+    };
+
+    //Replaces basis of the ideal with its Groebner basis. Limits, progress and checkpoints of Ideal aren't used.
+    template<typename Polynom>
+    void make_groebner_basis(Ideal<Polynom>* ideal, const Options& options = {}) {
+        if (ideal->get_basis_type() != BasisType::Any && !options.boolean_ring) { return; }
+        std::vector<Polynom> basis = GroebnerBasisBuilder<Polynom>().build(ideal->get_basis(), options);
+        ideal->assign_basis(std::move(basis), BasisType::Groebner);
+    }
+}// namespace gf2
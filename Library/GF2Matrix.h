@@ -0,0 +1,131 @@
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+//Dense matrix over GF(2) with rows packed into 64-bit words, so that adding rows is xor of words.
+//Column c of a row is bit c % 64 of its word c / 64.
+class GF2Matrix {
+public:
+    //Columns are eliminated in blocks of kTableBits by the Method of Four Russians:
+    //every row is reduced by all pivots of a block with one xor of a precomputed combination of pivot rows
+    static constexpr size_t kTableBits = 8;
+
+    GF2Matrix(size_t rows_count, size_t columns_count)
+        : rows_count_(rows_count), columns_count_(columns_count), words_((columns_count + 63) / 64),
+          data_(rows_count * words_) {}
+
+    size_t get_rows_count() const { return rows_count_; }
+    size_t get_columns_count() const { return columns_count_; }
+
+    bool get(size_t row, size_t column) const {
+        assert(row < rows_count_ && column < columns_count_);
+        return get_row(row)[column / 64] >> (column % 64) & 1;
+    }
+
+    void flip(size_t row, size_t column) {
+        assert(row < rows_count_ && column < columns_count_);
+        get_row(row)[column / 64] ^= uint64_t(1) << (column % 64);
+    }
+
+    //Column of the first nonzero entry, or columns count for zero row
+    size_t get_leading_column(size_t row) const {
+        const uint64_t* r = get_row(row);
+        for (size_t w = 0; w < words_; ++w) {
+            if (r[w]) { return w * 64 + std::countr_zero(r[w]); }
+        }
+        return columns_count_;
+    }
+
+    //Brings the matrix to reduced row echelon form and returns its rank.
+    //Nonzero rows go first in increasing order of their leading columns.
+    size_t echelonize() {
+        size_t rank = 0;
+        std::vector<uint32_t> block(rows_count_);
+        std::vector<uint64_t> table;
+        for (size_t column = 0; column < columns_count_ && rank < rows_count_; column += kTableBits) {
+            size_t width = std::min(kTableBits, columns_count_ - column);
+            for (size_t i = rank; i < rows_count_; ++i) { block[i] = get_bits(i, column, width); }
+            //Pivots are chosen by elimination on bits of the block only, pivot rows themselves are reduced lazily
+            size_t pivot_columns[kTableBits];
+            size_t found = 0;
+            for (size_t c = 0; c < width && rank + found < rows_count_; ++c) {
+                size_t pivot = rank + found;
+                size_t p = pivot;
+                while (p < rows_count_ && !(block[p] >> c & 1)) { ++p; }
+                if (p == rows_count_) { continue; }
+                swap_rows(p, pivot);
+                std::swap(block[p], block[pivot]);
+                for (size_t q = 0; q < found; ++q) {
+                    if (get(pivot, pivot_columns[q])) { add_row(pivot, rank + q, column / 64); }
+                }
+                assert(get_bits(pivot, column, width) == block[pivot]);
+                for (size_t i = pivot + 1; i < rows_count_; ++i) {
+                    if (block[i] >> c & 1) { block[i] ^= block[pivot]; }
+                }
+                pivot_columns[found++] = column + c;
+            }
+            if (!found) { continue; }
+            //Earlier pivot rows of the block are cleared at later pivot columns
+            for (size_t q2 = found; q2-- > 0;) {
+                for (size_t q1 = 0; q1 < q2; ++q1) {
+                    if (get(rank + q1, pivot_columns[q2])) { add_row(rank + q1, rank + q2, column / 64); }
+                }
+            }
+            //Rows are zero before the block except the ones above rank, which aren't affected there
+            size_t first_word = column / 64, width_words = words_ - first_word;
+            table.assign(width_words << found, 0);
+            for (size_t mask = 1; mask < (size_t(1) << found); ++mask) {
+                const uint64_t* base = table.data() + (mask & (mask - 1)) * width_words;
+                const uint64_t* pivot_row = get_row(rank + std::countr_zero(mask)) + first_word;
+                uint64_t* entry = table.data() + mask * width_words;
+                for (size_t w = 0; w < width_words; ++w) { entry[w] = base[w] ^ pivot_row[w]; }
+            }
+            for (size_t i = 0; i < rows_count_; ++i) {
+                if (i == rank) {
+                    i += found - 1;
+                    continue;
+                }
+                size_t mask = 0;
+                for (size_t q = 0; q < found; ++q) { mask |= size_t(get(i, pivot_columns[q])) << q; }
+                if (!mask) { continue; }
+                const uint64_t* entry = table.data() + mask * width_words;
+                uint64_t* r = get_row(i) + first_word;
+                for (size_t w = 0; w < width_words; ++w) { r[w] ^= entry[w]; }
+            }
+            rank += found;
+        }
+        return rank;
+    }
+
+private:
+    uint64_t* get_row(size_t row) { return data_.data() + row * words_; }
+    const uint64_t* get_row(size_t row) const { return data_.data() + row * words_; }
+
+    //Bits of columns [column, column + width) as integer, width is at most 64
+    uint64_t get_bits(size_t row, size_t column, size_t width) const {
+        const uint64_t* r = get_row(row);
+        size_t w = column / 64, shift = column % 64;
+        uint64_t bits = r[w] >> shift;
+        if (shift && w + 1 < words_) { bits |= r[w + 1] << (64 - shift); }
+        return width == 64 ? bits : bits & ((uint64_t(1) << width) - 1);
+    }
+
+    //Adds source to target starting from word first_word, earlier words of source must be zero
+    void add_row(size_t target, size_t source, size_t first_word) {
+        uint64_t* t = get_row(target);
+        const uint64_t* s = get_row(source);
+        for (size_t w = first_word; w < words_; ++w) { t[w] ^= s[w]; }
+    }
+
+    void swap_rows(size_t row1, size_t row2) {
+        if (row1 != row2) { std::swap_ranges(get_row(row1), get_row(row1) + words_, get_row(row2)); }
+    }
+
+    size_t rows_count_;
+    size_t columns_count_;
+    size_t words_;
+    std::vector<uint64_t> data_;
+};
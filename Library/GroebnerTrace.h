@@ -0,0 +1,160 @@
+#pragma once
+#include "Ideal.h"
+
+//Trace of a Buchberger run for replaying it on systems of the same shape: the same generators up to coefficients,
+//e.g. the same system modulo another prime or a parametric family at another point. The trace keeps pairs, whose
+//remainders were added to the basis, with reducers and monomials of all reduction steps and leading monomials
+//of the remainders. Replay computes only those S-polynomials and applies the recorded steps without searching for
+//reducers, pairs reducing to zero are skipped altogether. Any mismatch of a term or a leading monomial falls back
+//to the full computation.
+//Like any trace algorithm, replay assumes that skipped pairs reduce to zero again. This holds for all but special
+//coefficients, which can be excluded by the optional check of the Buchberger criterion for the result.
+template<typename Polynom>
+class GroebnerTrace {
+    using Monom = typename Polynom::Monom_;
+    using Order = typename Polynom::MonomialOrder_;
+    static_assert(!is_integer<typename Monom::CoefficientType_>::value, "Traces are recorded over fields");
+
+    struct Reduction {
+        size_t reducer;
+        Monom monomial;
+    };
+
+    //Remainder of the pair (i, j) after reductions [previous step's reductions_end, reductions_end)
+    struct Step {
+        size_t i;
+        size_t j;
+        size_t reductions_end;
+        Monom leading;
+    };
+
+public:
+    GroebnerTrace() = default;
+
+    //Computes the reduced Groebner basis of the ideal and records the trace of it. Limits are checked between pairs
+    //and between reduction passes like in Ideal, memory is counted in an arena the learning run allocates in.
+    //If they are exceeded, nullopt is returned and the ideal is left unchanged.
+    //Limits, progress and checkpoints set on the Ideal aren't used.
+    static std::optional<GroebnerTrace> learn(Ideal<Polynom>* ideal,
+                                              const typename Ideal<Polynom>::ComputationLimits& limits = {}) {
+        auto start_time = std::chrono::steady_clock::now();
+        memory::ComputationArena arena;
+        auto is_within_limits = [&] {
+            if (limits.time.count() && std::chrono::steady_clock::now() - start_time >= limits.time) { return false; }
+            return !limits.memory_bytes || arena.get_allocated_bytes() <= limits.memory_bytes;
+        };
+        //Declared after the arena, so they are destroyed before it on early return
+        GroebnerTrace trace;
+        std::vector<Polynom> store;
+        {
+            memory::ScopedResource scope(arena.get_resource());
+            store = ideal->get_basis();
+            for (const Polynom& p : store) { trace.generators_.push_back(get_shape(p.get_highest_monomial())); }
+            for (size_t i = 0; i < store.size(); ++i) {
+                for (size_t j = 0; j < i; ++j) {
+                    if (!is_within_limits()) { return std::nullopt; }
+                    if (gcd(store[i].get_highest_monomial(), store[j].get_highest_monomial()).get_degree() == 0) {
+                        continue;
+                    }
+                    Polynom p = get_S_polynomial(store[i], store[j]);
+                    size_t reductions_begin = trace.reductions_.size();
+                    for (bool was_reduced = true; was_reduced;) {
+                        if (!is_within_limits()) { return std::nullopt; }
+                        was_reduced = false;
+                        for (size_t k = 0; k < store.size(); ++k) {
+                            Monom m = p.get_highest_monomial_divisible_by(store[k].get_highest_monomial());
+                            if (m.is_zero()) { continue; }
+                            trace.reductions_.push_back({k, get_shape(m)});
+                            store[k].do_one_elementary_reduction_at(p, m);
+                            was_reduced = true;
+                        }
+                    }
+                    if (p.is_zero()) {
+                        trace.reductions_.resize(reductions_begin);
+                        ++trace.zero_reductions_count_;
+                        continue;
+                    }
+                    p.normalize();
+                    trace.steps_.push_back({i, j, trace.reductions_.size(), get_shape(p.get_highest_monomial())});
+                    store.push_back(std::move(p));
+                }
+            }
+        }
+        //Copies are made on the default resource and outlive the arena
+        std::optional<GroebnerTrace> res(trace);
+        ideal->assign_basis(std::vector<Polynom>(store.begin(), store.end()), BasisType::Groebner);
+        ideal->make_reduced_groebner_basis();
+        return res;
+    }
+
+    //Makes the reduced Groebner basis of the ideal by replaying the trace on its generators, which must go in the
+    //same order as in the learning run. Returns false if the trace doesn't apply or the check fails, then the basis is
+    //computed by make_reduced_groebner_basis from the original generators.
+    bool replay(Ideal<Polynom>* ideal, bool check_result = false) const {
+        if (ideal->get_basis_type() != BasisType::Any) {
+            ideal->make_reduced_groebner_basis();
+            return true;
+        }
+        std::vector<Polynom> generators = ideal->get_basis();
+        std::vector<Polynom> store = generators;
+        if (apply(&store)) {
+            ideal->assign_basis(std::move(store), BasisType::Groebner);
+            ideal->make_reduced_groebner_basis();
+            if (!check_result || is_groebner_basis(*ideal)) { return true; }
+        }
+        ideal->assign_basis(std::move(generators), BasisType::Any);
+        ideal->make_reduced_groebner_basis();
+        return false;
+    }
+
+    //Number of recorded pairs
+    size_t size() const { return steps_.size(); }
+
+    //Pairs of the learning run reduced to zero, which replay skips
+    size_t get_zero_reductions_count() const { return zero_reductions_count_; }
+
+private:
+    static Monom get_shape(const Monom& m) {
+        std::vector<std::pair<typename Monom::Variable_, typename Monom::DegreeType_>> powers;
+        for (const auto& [var, deg] : m.get_variables_ascending_order()) { powers.emplace_back(var, deg); }
+        return Monom(1, powers);
+    }
+
+    static bool is_same_monomial(const Monom& m1, const Monom& m2) { return !Order()(m1, m2) && !Order()(m2, m1); }
+
+    static bool is_groebner_basis(const Ideal<Polynom>& ideal) {
+        const auto& basis = ideal.get_basis();
+        for (size_t i = 0; i < basis.size(); ++i) {
+            for (size_t j = 0; j < i; ++j) {
+                if (!ideal.is_redusable_to_zero(get_S_polynomial(basis[i], basis[j]))) { return false; }
+            }
+        }
+        return true;
+    }
+
+    bool apply(std::vector<Polynom>* store) const {
+        if (store->size() != generators_.size()) { return false; }
+        for (size_t i = 0; i < store->size(); ++i) {
+            if (!is_same_monomial((*store)[i].get_highest_monomial(), generators_[i])) { return false; }
+        }
+        size_t r = 0;
+        for (const Step& step : steps_) {
+            Polynom p = get_S_polynomial((*store)[step.i], (*store)[step.j]);
+            for (; r < step.reductions_end; ++r) {
+                const Reduction& reduction = reductions_[r];
+                if (!(*store)[reduction.reducer].do_one_elementary_reduction_at(p, reduction.monomial)) {
+                    return false;
+                }
+            }
+            if (p.is_zero() || !is_same_monomial(p.get_highest_monomial(), step.leading)) { return false; }
+            p.normalize();
+            store->push_back(std::move(p));
+        }
+        return true;
+    }
+
+    std::vector<Monom> generators_;
+    std::vector<Step> steps_;
+    std::vector<Reduction> reductions_;
+    size_t zero_reductions_count_ = 0;
+};
@@ -0,0 +1,153 @@
+#pragma once
+#include "MonomialIdeal.h"
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+//Hilbert series of S / I for a monomial ideal I in the ring S of n variables, stored as K(t) / (1 - t)^n.
+//The numerator K(t) doesn't depend on n, it's computed by the pivot algorithm:
+//K(I) = K(I + (p)) + t^deg(p) K(I : p) for a pivot monomial p, until generators are pairwise coprime
+class HilbertSeries {
+public:
+    using Exponents = MonomialIdeal::Exponents;
+
+    HilbertSeries() = default;
+
+    //Generators may have fewer exponents than variables, missing ones are zero
+    HilbertSeries(const std::vector<Exponents>& generators, size_t variables_count)
+        : HilbertSeries(MonomialIdeal(generators, variables_count)) {}
+
+    explicit HilbertSeries(const MonomialIdeal& ideal)
+        : numerator_(compute_numerator(ideal)), variables_count_(ideal.get_variables_count()) {}
+
+    //Coefficients of K(t) starting from the free one
+    const std::vector<int64_t>& get_numerator() const { return numerator_; }
+
+    size_t get_variables_count() const { return variables_count_; }
+
+    //Numerator after cancelling all common factors 1 - t, then the denominator is (1 - t)^dimension
+    std::vector<int64_t> get_reduced_numerator() const { return reduce().first; }
+
+    //Krull dimension of S / I, zero for a finite number of standard monomials
+    size_t get_dimension() const { return reduce().second; }
+
+    //Multiplicity of S / I, for dimension 0 this is the number of standard monomials
+    int64_t get_degree() const {
+        int64_t degree = 0;
+        for (int64_t c : get_reduced_numerator()) { degree += c; }
+        return degree;
+    }
+
+    //Number of standard monomials of the given degree
+    int64_t get_hilbert_function(int64_t degree) const {
+        int64_t res = 0;
+        for (size_t k = 0; k < numerator_.size() && int64_t(k) <= degree; ++k) {
+            res += numerator_[k] * count_monomials(degree - k, variables_count_);
+        }
+        return res;
+    }
+
+    bool operator==(const HilbertSeries& rhs) const {
+        return numerator_ == rhs.numerator_ && variables_count_ == rhs.variables_count_;
+    }
+    friend bool operator!=(const HilbertSeries& lhs, const HilbertSeries& rhs) { return !(lhs == rhs); }
+
+    friend std::ostream& operator<<(std::ostream& os, const HilbertSeries& series) {
+        auto [numerator, dimension] = series.reduce();
+        os << "(";
+        bool first = true;
+        for (size_t k = 0; k < numerator.size(); ++k) {
+            if (numerator[k] == 0) { continue; }
+            int64_t c = numerator[k];
+            if (!first) { os << (c < 0 ? " - " : " + "); }
+            if (first && c < 0) { os << "-"; }
+            c = c < 0 ? -c : c;
+            if (c != 1 || k == 0) { os << c; }
+            if (k > 0) { os << "t"; }
+            if (k > 1) { os << "^" << k; }
+            first = false;
+        }
+        if (first) { os << "0"; }
+        return os << ") / (1 - t)^" << dimension;
+    }
+
+private:
+    using Numerator = std::vector<int64_t>;
+
+    //Monomials of the given degree in n variables
+    static int64_t count_monomials(int64_t degree, size_t n) {
+        if (n == 0) { return degree == 0; }
+        int64_t res = 1;
+        for (size_t i = 1; i < n; ++i) { res = res * (degree + int64_t(i)) / int64_t(i); }
+        return res;
+    }
+
+    std::pair<Numerator, size_t> reduce() const {
+        Numerator numerator = numerator_;
+        size_t dimension = variables_count_;
+        auto value_at_one = [&numerator] {
+            int64_t value = 0;
+            for (int64_t c : numerator) { value += c; }
+            return value;
+        };
+        while (dimension > 0 && !numerator.empty() && value_at_one() == 0) {
+            //Division by 1 - t: quotient coefficients are prefix sums
+            Numerator quotient(numerator.size() - 1);
+            int64_t sum = 0;
+            for (size_t k = 0; k + 1 < numerator.size(); ++k) { quotient[k] = sum += numerator[k]; }
+            numerator = std::move(quotient);
+            --dimension;
+        }
+        while (!numerator.empty() && numerator.back() == 0) { numerator.pop_back(); }
+        return {numerator, dimension};
+    }
+
+    static void add_shifted(Numerator* res, const Numerator& p, size_t shift) {
+        if (res->size() < p.size() + shift) { res->resize(p.size() + shift); }
+        for (size_t k = 0; k < p.size(); ++k) { (*res)[k + shift] += p[k]; }
+    }
+
+    static Numerator compute_numerator(const MonomialIdeal& ideal) {
+        std::vector<Exponents> generators = ideal.get_generators();
+        size_t variables = ideal.get_variables_count();
+        //Base case: for pairwise coprime generators K(t) is the product of 1 - t^deg
+        std::vector<size_t> occurrences(variables);
+        for (const auto& m : generators) {
+            for (size_t i = 0; i < variables; ++i) { occurrences[i] += m[i] > 0; }
+        }
+        size_t pivot_variable = std::max_element(occurrences.begin(), occurrences.end()) - occurrences.begin();
+        if (variables == 0 || occurrences[pivot_variable] <= 1) {
+            Numerator res = {1};
+            for (const auto& m : generators) {
+                Numerator factor = res;
+                for (auto& c : factor) { c = -c; }
+                add_shifted(&res, factor, MonomialIdeal::get_degree(m));
+            }
+            return res;
+        }
+        //Pivot is x^e for the lower median e of positive exponents of the most frequent variable x. It isn't in
+        //the ideal: a generator x^k, k <= e, would make other generators with x redundant, and k would be the maximum
+        std::vector<int64_t> exponents;
+        for (const auto& m : generators) {
+            if (m[pivot_variable] > 0) { exponents.push_back(m[pivot_variable]); }
+        }
+        std::nth_element(exponents.begin(), exponents.begin() + (exponents.size() - 1) / 2, exponents.end());
+        int64_t e = exponents[(exponents.size() - 1) / 2];
+        Exponents pivot(variables);
+        pivot[pivot_variable] = e;
+        //Generators of I + (x^e) are x^e and the ones with smaller exponent of x
+        std::vector<Exponents> sum = {pivot};
+        for (auto& m : generators) {
+            if (m[pivot_variable] < e) { sum.push_back(std::move(m)); }
+        }
+        Numerator res = compute_numerator(MonomialIdeal(sum, variables));
+        add_shifted(&res, compute_numerator(ideal.colon(pivot)), e);
+        while (!res.empty() && res.back() == 0) { res.pop_back(); }
+        return res;
+    }
+
+    Numerator numerator_ = {1};
+    size_t variables_count_ = 0;
+};
@@ -1,5 +1,19 @@
 #pragma once
+#include "../Fields/Overflow.h"
 #include "Polynomial.h"
+#include "HilbertSeries.h"
+#include "MonomialIdeal.h"
+#include "NormalFormCache.h"
+#include "Reducer.h"
+#include "Statistics.h"
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <optional>
+#include <queue>
+#include <span>
+#include <stop_token>
+#include <thread>
 
 template<typename>
 struct is_polynomial : std::false_type {};
@@ -9,11 +23,57 @@ struct is_polynomial<Polynomial<A, B>> : std::true_type {};
 
 enum BasisType { Any, Groebner, MinimalGroebner, ReducedGroebner };
 
+//Interrupted computation keeps its partial basis and position, calling it again continues from there.
+//ArithmeticOverflow means that exponents or coefficients don't fit their types, see Fields/Overflow.h,
+//the basis is kept as well, but calling again fails the same way.
+enum class ComputationStatus { Completed, Cancelled, TimeLimitExceeded, MemoryLimitExceeded, ArithmeticOverflow };
+
 template<typename Polynom>
 class Ideal {
     static_assert(is_polynomial<Polynom>::value);
 
 public:
+    struct MembershipResult {
+        bool contains;
+        Polynom remainder;
+    };
+
+    struct BuchbergerStatistics {
+        uint64_t processed_pairs = 0;
+        uint64_t coprime_pairs = 0;
+        uint64_t zero_reductions = 0;
+    };
+
+    //Buchberger's algorithm processes pairs (i, j), j < i, in increasing order of i, then j.
+    //All pairs starting from (next_i, next_j) are pending, so together with the basis this is the whole state.
+    struct BuchbergerState {
+        uint64_t next_i = 0;
+        uint64_t next_j = 0;
+        BuchbergerStatistics statistics;
+    };
+
+    //Checkpoint handler is called before a pair is processed once either limit is reached, 0 disables a limit
+    struct CheckpointPolicy {
+        uint64_t every_pairs = 0;
+        std::chrono::milliseconds every_time{0};
+    };
+
+    struct Progress {
+        size_t basis_size;
+        uint64_t pending_pairs;
+        //Degree of lcm of leading monomials of the pair to be processed next
+        typename Polynom::Monom_::DegreeType_ current_degree;
+        uint64_t processed_pairs;
+        std::chrono::nanoseconds elapsed;
+    };
+
+    //Limits of a single make_groebner_basis call, 0 disables a limit. Memory is counted in bytes taken by the arena,
+    //so it requires arenas to be enabled. Limits are checked between pairs and between reduction passes.
+    struct ComputationLimits {
+        std::chrono::milliseconds time{0};
+        size_t memory_bytes = 0;
+    };
+
     Ideal() = default;
 
     Ideal(const std::initializer_list<Polynom>& list) {
@@ -28,8 +88,8 @@ public:
         for (const auto& p : store) { insert(p); }
     }
 
-    Ideal(const std::vector<Polynom>&& store) {
-        for (const auto& p : store) { insert(std::move(p)); }
+    Ideal(std::vector<Polynom>&& store) {
+        for (auto& p : store) { insert(std::move(p)); }
     }
 
     void insert(const Polynom& p) {
@@ -37,67 +97,285 @@ public:
             basis_type_ = BasisType::Any;
             store_.push_back(p);
             store_.back().normalize();
+            invalidate_normal_form_cache();
         }
     }
 
-    void insert(const Polynom&& p) {
+    void insert(Polynom&& p) {
         if (!p.is_zero()) {
             basis_type_ = BasisType::Any;
             store_.push_back(std::move(p));
             store_.back().normalize();
+            invalidate_normal_form_cache();
         }
     }
 
     void insert(const std::string& s) { insert(Polynom(s)); }
 
+    //Replaces generators by normalized polynomials known to form a basis of the given type, e.g. one saved earlier.
+    //Position of an interrupted computation refers to the old generators and is dropped.
+    void assign_basis(std::vector<Polynom>&& basis, BasisType basis_type) {
+        store_ = std::move(basis);
+        basis_type_ = basis_type;
+        buchberger_state_ = {};
+        invalidate_normal_form_cache();
+    }
+
+    //Fraction-free reductions over the integers scale rhs, so its content is removed once per pass
     bool reduce_by_set_once(Polynom* rhs) const {
         bool was_reduced = false;
-        for (const Polynom& p : store_) { was_reduced |= p.do_one_elementary_reduction_over(*rhs); }
+        for (const Polynom& p : store_) {
+            if (p.do_one_elementary_reduction_over(*rhs)) {
+                was_reduced = true;
+                recorder_.count_reduction_step();
+            }
+        }
+        if constexpr (is_integer<typename Polynom::Monom_::CoefficientType_>::value) {
+            if (was_reduced) { rhs->normalize(); }
+        }
+        return was_reduced;
+    }
+
+    //Cancels leading terms only, the tail of rhs stays unreduced
+    bool top_reduce_by_set_once(Polynom* rhs) const {
+        bool was_reduced = false;
+        for (const Polynom& p : store_) {
+            if (p.do_one_top_reduction_over(*rhs)) {
+                was_reduced = true;
+                recorder_.count_reduction_step();
+            }
+        }
+        if constexpr (is_integer<typename Polynom::Monom_::CoefficientType_>::value) {
+            if (was_reduced) { rhs->normalize(); }
+        }
         return was_reduced;
     }
 
     void reduce(Polynom* rhs) const {
+        [[maybe_unused]] auto timer = recorder_.time(instrumentation::Reduction);
         while (reduce_by_set_once(rhs)) {}
     }
 
     bool is_redusable_to_zero(Polynom rhs) const {
+        if (normal_form_cache_) { return get_normal_form(rhs).is_zero(); }
         reduce(&rhs);
         return rhs.is_zero();
     }
 
-    void make_groebner_basis() {
-        if (basis_type_ != BasisType::Any) { return; }
-        for (size_t i = 0; i < store_.size(); ++i) {
-            for (size_t j = 0; j < i; ++j) {
-                if (are_leading_monomials_coprime(store_[i], store_[j])) { continue; }
-                Polynom p = get_S_polynomial(store_[i], store_[j]);
-                reduce(&p);
-                insert(std::move(p));
+    //In memoized mode normal forms are assembled from cached normal forms of monomials.
+    //The cache is dropped whenever the basis changes. Not thread-safe, use contains_each for concurrent queries.
+    void enable_normal_form_cache(size_t max_terms = NormalFormCache<Polynom>::kDefaultMaxTerms) {
+        if (normal_form_cache_) {
+            normal_form_cache_->set_max_terms(max_terms);
+        } else {
+            normal_form_cache_.emplace(max_terms);
+        }
+    }
+
+    void disable_normal_form_cache() {
+        normal_form_cache_.reset();
+        cache_reducer_.reset();
+    }
+
+    bool is_normal_form_cache_enabled() const { return normal_form_cache_.has_value(); }
+
+    typename NormalFormCache<Polynom>::Statistics get_normal_form_cache_statistics() const {
+        if (!normal_form_cache_) { return {}; }
+        return normal_form_cache_->get_statistics();
+    }
+
+    Polynom get_normal_form(const Polynom& p) const {
+        if (!normal_form_cache_) {
+            Polynom res = p;
+            reduce(&res);
+            return res;
+        }
+        if (!cache_reducer_) { cache_reducer_.emplace(store_); }
+        return normal_form_cache_->normal_form(p, *cache_reducer_);
+    }
+
+    //With lazy tail reduction S-polynomials are top-reduced first, which is enough to find zero reductions.
+    //Tails are reduced only for nonzero remainders before they become reducers. It's ignored over the integers:
+    //remainders depend on the order of reductions, and this one gives coefficients overflowing 64 bits.
+    void set_lazy_tail_reduction(bool enabled) {
+        lazy_tail_reduction_ = enabled && !is_integer<typename Polynom::Monom_::CoefficientType_>::value;
+    }
+
+    bool is_lazy_tail_reduction() const { return lazy_tail_reduction_; }
+
+    //Temporaries of make_groebner_basis and reduce_each are taken from an arena on top of upstream,
+    //which is released at once when computation ends. nullptr disables arenas.
+    void set_memory_resource(std::pmr::memory_resource* upstream) { arena_upstream_ = upstream; }
+
+    std::pmr::memory_resource* get_memory_resource() const { return arena_upstream_; }
+
+    void set_checkpoint_handler(std::function<void(const Ideal&)> handler, CheckpointPolicy policy) {
+        checkpoint_handler_ = std::move(handler);
+        checkpoint_policy_ = policy;
+    }
+
+    void reset_checkpoint_handler() { checkpoint_handler_ = nullptr; }
+
+    //Handler is called before every every_pairs-th pair is processed
+    void set_progress_handler(std::function<void(const Progress&)> handler, uint64_t every_pairs = 1) {
+        assert(every_pairs > 0);
+        progress_handler_ = std::move(handler);
+        progress_every_pairs_ = every_pairs;
+    }
+
+    void reset_progress_handler() { progress_handler_ = nullptr; }
+
+    void set_computation_limits(const ComputationLimits& limits) { limits_ = limits; }
+
+    const ComputationLimits& get_computation_limits() const { return limits_; }
+
+    //Computation stops with ComputationStatus::Cancelled once stop is requested, the token may be signalled from
+    //any thread. Pass default constructed token to disable cancellation.
+    void set_stop_token(std::stop_token stop_token) { stop_token_ = std::move(stop_token); }
+
+    //Known Hilbert series of a homogeneous ideal, e.g. computed in Grevlex or modulo a prime, switches
+    //make_groebner_basis to processing pairs by degree. Once the leading monomials of a degree are all found,
+    //the remaining pairs of that degree are skipped: they would reduce to zero. Checkpoints aren't made in this mode,
+    //and interrupted computation forms pairs again on the next call. The series is ignored for non-homogeneous
+    //generators, and a series that turns out not to match the ideal falls back to the computation without it.
+    void set_hilbert_series(HilbertSeries series) { hilbert_series_ = std::move(series); }
+
+    void reset_hilbert_series() { hilbert_series_.reset(); }
+
+    //Hilbert series of S / LT(I), where S is the ring of variables of the basis. It's also the series of S / I,
+    //so the basis must already be a Groebner basis
+    HilbertSeries get_hilbert_series() const {
+        assert(basis_type_ != BasisType::Any && "Groebner basis must be computed before Hilbert series");
+        std::set<typename Polynom::Monom_::Variable_> variables;
+        for (const auto& p : store_) {
+            for (const auto& m : p.get_monomials_ascending_order()) {
+                for (const auto& [var, deg] : m.get_variables_ascending_order()) { variables.insert(var); }
             }
         }
-        basis_type_ = BasisType::Groebner;
+        return HilbertSeries(get_leading_exponents(), variables.size());
     }
 
-    void make_minimal_groebner_basis() {
-        if (basis_type_ == BasisType::MinimalGroebner || basis_type_ == BasisType::ReducedGroebner) { return; }
-        make_groebner_basis();
+    bool is_homogeneous() const {
+        return std::all_of(store_.begin(), store_.end(), [](const Polynom& p) { return p.is_homogeneous(); });
+    }
+
+    //Replaces generators by their homogenizations with the new variable h
+    void homogenize(const typename Polynom::Monom_::Variable_& h) {
+        for (auto& p : store_) { p = p.homogenize(h); }
+        basis_type_ = BasisType::Any;
+        buchberger_state_ = {};
+        invalidate_normal_form_cache();
+    }
+
+    //Substitutes h = 1. A Groebner basis of a homogeneous ideal in Grevlex with h smaller than the other variables
+    //stays a Groebner basis: its leading monomials contain h only if all terms do, so they don't change but for h.
+    void dehomogenize(const typename Polynom::Monom_::Variable_& h) {
+        bool keeps_basis = basis_type_ != BasisType::Any && is_homogeneous() &&
+                           std::is_same_v<typename Polynom::MonomialOrder_, MonomialOrders::Grevlex> &&
+                           is_smallest_variable(h);
+        std::vector<Polynom> store = std::move(store_);
+        store_.clear();
+        for (const auto& p : store) { insert(p.dehomogenize(h)); }
+        basis_type_ = keeps_basis ? BasisType::Groebner : BasisType::Any;
+        buchberger_state_ = {};
+    }
+
+    //State of unfinished make_groebner_basis, or statistics of the finished one with zero position
+    const BuchbergerState& get_buchberger_state() const { return buchberger_state_; }
+
+    //Continues computation saved with get_basis and get_buchberger_state on the next make_groebner_basis call
+    void restore_buchberger_state(std::vector<Polynom>&& store, const BuchbergerState& state) {
+        store_ = std::move(store);
+        basis_type_ = BasisType::Any;
+        buchberger_state_ = state;
+        invalidate_normal_form_cache();
+    }
+
+    //Collected only when GROEBNER_STATISTICS is defined, otherwise always zero.
+    //Counters are not synchronized, so const methods of an instrumented ideal must not run concurrently.
+    const instrumentation::Statistics& get_statistics() const { return recorder_.get(); }
+
+    void reset_statistics() { recorder_.reset(); }
+
+    ComputationStatus make_groebner_basis() {
+        if (basis_type_ != BasisType::Any) { return ComputationStatus::Completed; }
+        assert((!limits_.memory_bytes || arena_upstream_) && "Memory limit can't be checked with disabled arenas");
+        [[maybe_unused]] auto timer = recorder_.time(instrumentation::GroebnerBasis);
+        overflow::reset();
+        if (hilbert_series_ && is_homogeneous()) { return make_groebner_basis_by_degree(); }
+        return make_groebner_basis_by_pairs();
+    }
+
+    //Processes pairs of homogeneous polynomials in increasing degree and stops before degree max_degree + 1. The basis
+    //is then correct up to that degree: every polynomial of the ideal of degree at most max_degree reduces to zero.
+    //Basis type becomes Groebner only if no pairs of higher degree are left. Non-homogeneous generators have no such
+    //bound, their whole basis is computed.
+    ComputationStatus make_groebner_basis_up_to_degree(typename Polynom::Monom_::DegreeType_ max_degree) {
+        if (basis_type_ != BasisType::Any) { return ComputationStatus::Completed; }
+        assert((!limits_.memory_bytes || arena_upstream_) && "Memory limit can't be checked with disabled arenas");
+        [[maybe_unused]] auto timer = recorder_.time(instrumentation::GroebnerBasis);
+        overflow::reset();
+        if (!is_homogeneous()) { return make_groebner_basis_by_pairs(); }
+        return make_groebner_basis_by_degree(max_degree);
+    }
+
+    ComputationStatus make_minimal_groebner_basis() {
+        if (basis_type_ == BasisType::MinimalGroebner || basis_type_ == BasisType::ReducedGroebner) {
+            return ComputationStatus::Completed;
+        }
+        if (auto status = make_groebner_basis(); status != ComputationStatus::Completed) { return status; }
         exclude_unnecessary_polinomials();
         basis_type_ = BasisType::MinimalGroebner;
+        return ComputationStatus::Completed;
     }
 
-    void make_reduced_groebner_basis() {
-        if (basis_type_ == BasisType::ReducedGroebner) { return; }
-        make_minimal_groebner_basis();
-        reduce_each();
+    ComputationStatus make_reduced_groebner_basis() {
+        if (basis_type_ == BasisType::ReducedGroebner) { return ComputationStatus::Completed; }
+        if (auto status = make_minimal_groebner_basis(); status != ComputationStatus::Completed) { return status; }
+        if (auto status = reduce_each(); status != ComputationStatus::Completed) { return status; }
         assert(are_all_polynomials_normalized());
         basis_type_ = BasisType::ReducedGroebner;
+        return ComputationStatus::Completed;
     }
 
+    //If make_groebner_basis is interrupted, false means that membership is unknown
     bool contains(Polynom p) {
         make_groebner_basis();
         return is_redusable_to_zero(p);
     }
 
+    //Builds read-only index over current basis, which must already be a Groebner basis
+    Reducer<Polynom> get_reducer() const {
+        assert(basis_type_ != BasisType::Any && "Groebner basis must be computed before building a reducer");
+        return Reducer<Polynom>(store_);
+    }
+
+    //Computes normal forms of all polynomials concurrently. Doesn't modify the ideal,
+    //so make_groebner_basis (or a stronger variant) must be called beforehand.
+    std::vector<MembershipResult> contains_each(std::span<const Polynom> polynomials,
+                                                size_t threads_count = std::thread::hardware_concurrency()) const {
+        Reducer<Polynom> reducer = get_reducer();
+        std::vector<MembershipResult> results(polynomials.size());
+        std::atomic<size_t> next_index = 0;
+        auto worker = [&]() {
+            for (size_t i; (i = next_index.fetch_add(1, std::memory_order_relaxed)) < polynomials.size();) {
+                results[i].remainder = reducer.normal_form(polynomials[i]);
+                results[i].contains = results[i].remainder.is_zero();
+            }
+        };
+        threads_count = std::min(std::max<size_t>(threads_count, 1), polynomials.size());
+        if (threads_count <= 1) {
+            worker();
+            return results;
+        }
+        std::vector<std::thread> threads;
+        threads.reserve(threads_count - 1);
+        for (size_t i = 0; i + 1 < threads_count; ++i) { threads.emplace_back(worker); }
+        worker();
+        for (auto& thread : threads) { thread.join(); }
+        return results;
+    }
+
     bool basis_contains(const Polynom& p) const {
         for (const auto& polynom : store_) {
             if (p == polynom) { return true; }
@@ -115,9 +393,15 @@ public:
 
     size_t size() const { return store_.size(); }
 
+    const std::vector<Polynom>& get_basis() const { return store_; }
+
+    BasisType get_basis_type() const { return basis_type_; }
+
     void clear() {
         basis_type_ = BasisType::Any;
+        buchberger_state_ = {};
         store_.clear();
+        invalidate_normal_form_cache();
     }
 
     friend std::ostream& operator<<(std::ostream& os, const Ideal& ideal) {
@@ -127,45 +411,327 @@ public:
     }
 
 private:
+    bool is_checkpoint_due(uint64_t last_pairs, std::chrono::steady_clock::time_point last_time) const {
+        const auto& [every_pairs, every_time] = checkpoint_policy_;
+        if (every_pairs && buchberger_state_.statistics.processed_pairs - last_pairs >= every_pairs) { return true; }
+        return every_time.count() && std::chrono::steady_clock::now() - last_time >= every_time;
+    }
+
+    Progress get_progress(std::chrono::steady_clock::time_point start_time) const {
+        const auto& [i, j, statistics] = buchberger_state_;
+        uint64_t n = store_.size();
+        const auto& m1 = store_[i].get_highest_monomial();
+        const auto& m2 = store_[j].get_highest_monomial();
+        return {store_.size(), n * (n - 1) / 2 - i * (i - 1) / 2 - j, lcm(m1, m2).get_degree(),
+                statistics.processed_pairs, std::chrono::steady_clock::now() - start_time};
+    }
+
+    ComputationStatus check_limits(std::chrono::steady_clock::time_point start_time,
+                                   const memory::ComputationArena* arena) const {
+        if (stop_token_.stop_requested()) { return ComputationStatus::Cancelled; }
+        if (overflow::is_raised()) { return ComputationStatus::ArithmeticOverflow; }
+        if (limits_.time.count() && std::chrono::steady_clock::now() - start_time >= limits_.time) {
+            return ComputationStatus::TimeLimitExceeded;
+        }
+        if (limits_.memory_bytes && arena && arena->get_allocated_bytes() > limits_.memory_bytes) {
+            return ComputationStatus::MemoryLimitExceeded;
+        }
+        return ComputationStatus::Completed;
+    }
+
+    ComputationStatus reduce_within_limits(Polynom* rhs, std::chrono::steady_clock::time_point start_time,
+                                           const memory::ComputationArena* arena) const {
+        [[maybe_unused]] auto timer = recorder_.time(instrumentation::Reduction);
+        ComputationStatus status = ComputationStatus::Completed;
+        if (lazy_tail_reduction_) {
+            while (status == ComputationStatus::Completed && top_reduce_by_set_once(rhs)) {
+                status = check_limits(start_time, arena);
+            }
+            if (rhs->is_zero()) { return status; }
+        }
+        while (status == ComputationStatus::Completed && reduce_by_set_once(rhs)) {
+            status = check_limits(start_time, arena);
+        }
+        //S-polynomial itself or the last pass may overflow
+        if (status == ComputationStatus::Completed && overflow::is_raised()) {
+            status = ComputationStatus::ArithmeticOverflow;
+        }
+        return status;
+    }
+
+    //Exponents of leading monomials in variables that occur in them
+    std::vector<MonomialIdeal::Exponents> get_leading_exponents() const {
+        std::map<typename Polynom::Monom_::Variable_, size_t> indices;
+        std::vector<MonomialIdeal::Exponents> exponents;
+        for (const auto& p : store_) {
+            MonomialIdeal::Exponents& e = exponents.emplace_back(indices.size());
+            auto leading = p.get_highest_monomial();
+            for (const auto& [var, deg] : leading.get_variables_ascending_order()) {
+                size_t index = indices.emplace(var, indices.size()).first->second;
+                if (index >= e.size()) { e.resize(index + 1); }
+                e[index] = deg;
+            }
+        }
+        return exponents;
+    }
+
+    //Buchberger's algorithm over all pairs (i, j), j < i, in the order of the basis
+    ComputationStatus make_groebner_basis_by_pairs() {
+        auto& [i, j, statistics] = buchberger_state_;
+        if (i == 0 && j == 0) { statistics = {}; }
+        ComputationStatus status = ComputationStatus::Completed;
+        auto start_time = std::chrono::steady_clock::now();
+        run_in_arena([&](const memory::ComputationArena* arena) {
+            uint64_t last_checkpoint_pairs = statistics.processed_pairs;
+            auto last_checkpoint_time = start_time;
+            for (; i < store_.size(); ++i, j = 0) {
+                for (; j < i; ++j) {
+                    if (checkpoint_handler_ && is_checkpoint_due(last_checkpoint_pairs, last_checkpoint_time)) {
+                        call_outside_arena(checkpoint_handler_, *this);
+                        last_checkpoint_pairs = statistics.processed_pairs;
+                        last_checkpoint_time = std::chrono::steady_clock::now();
+                    }
+                    if (progress_handler_ && statistics.processed_pairs % progress_every_pairs_ == 0) {
+                        call_outside_arena(progress_handler_, get_progress(start_time));
+                    }
+                    if ((status = check_limits(start_time, arena)) != ComputationStatus::Completed) { return; }
+                    ++statistics.processed_pairs;
+                    recorder_.count_pair();
+                    if (are_leading_monomials_coprime(store_[i], store_[j])) {
+                        ++statistics.coprime_pairs;
+                        recorder_.count_coprime_pair();
+                        continue;
+                    }
+                    Polynom p = get_S_polynomial(store_[i], store_[j]);
+                    recorder_.count_s_polynomial_terms(p.size());
+                    if ((status = reduce_within_limits(&p, start_time, arena)) != ComputationStatus::Completed) {
+                        //The pair stays pending
+                        --statistics.processed_pairs;
+                        return;
+                    }
+                    recorder_.count_remainder_terms(p.size());
+                    if (p.is_zero()) {
+                        ++statistics.zero_reductions;
+                        recorder_.count_zero_reduction();
+                    }
+                    insert(std::move(p));
+                    recorder_.observe_basis_size(store_.size());
+                }
+            }
+        });
+        if (status != ComputationStatus::Completed) { return status; }
+        i = j = 0;
+        basis_type_ = BasisType::Groebner;
+        return status;
+    }
+
+    //Normal strategy: pairs are processed in increasing degree of lcm of leading monomials, pairs of degree above
+    //max_degree are dropped. For homogeneous input a nonzero remainder of a pair of degree d has degree d and adds
+    //one leading monomial. With Hilbert series the number of missing ones is the excess of the Hilbert function
+    //of the leading terms over the known one.
+    //If the series doesn't match, pairs it has skipped may be needed, so the basis is completed by all pairs.
+    ComputationStatus make_groebner_basis_by_degree(
+            std::optional<typename Polynom::Monom_::DegreeType_> max_degree = std::nullopt) {
+        assert(is_homogeneous() && "Computation by degree requires homogeneous polynomials");
+        using DegreeType = typename Polynom::Monom_::DegreeType_;
+        using Pair = std::tuple<DegreeType, size_t, size_t>;
+        buchberger_state_ = {};
+        auto& statistics = buchberger_state_.statistics;
+        ComputationStatus status = ComputationStatus::Completed;
+        bool is_truncated = false;
+        bool is_series_mismatched = false;
+        auto start_time = std::chrono::steady_clock::now();
+        run_in_arena([&](const memory::ComputationArena* arena) {
+            std::priority_queue<Pair, std::vector<Pair>, std::greater<>> pairs;
+            auto add_pairs = [&](size_t i) {
+                for (size_t j = 0; j < i; ++j) {
+                    auto degree = lcm(store_[i].get_highest_monomial(), store_[j].get_highest_monomial()).get_degree();
+                    if (max_degree && degree > *max_degree) {
+                        //Coprime pairs reduce to zero, so dropping them doesn't truncate the basis
+                        if (!are_leading_monomials_coprime(store_[i], store_[j])) { is_truncated = true; }
+                    } else {
+                        pairs.emplace(degree, i, j);
+                    }
+                }
+            };
+            for (size_t i = 0; i < store_.size(); ++i) { add_pairs(i); }
+            while (!pairs.empty()) {
+                DegreeType degree = std::get<0>(pairs.top());
+                int64_t missing = INT64_MAX;
+                if (hilbert_series_) {
+                    missing = HilbertSeries(get_leading_exponents(), hilbert_series_->get_variables_count())
+                                      .get_hilbert_function(degree) -
+                              hilbert_series_->get_hilbert_function(degree);
+                    if (missing < 0) {
+                        is_series_mismatched = true;
+                        return;
+                    }
+                }
+                while (!pairs.empty() && std::get<0>(pairs.top()) == degree) {
+                    auto [pair_degree, i, j] = pairs.top();
+                    pairs.pop();
+                    if (missing == 0) { continue; }
+                    if (progress_handler_ && statistics.processed_pairs % progress_every_pairs_ == 0) {
+                        call_outside_arena(progress_handler_,
+                                           Progress{store_.size(), pairs.size() + 1, degree,
+                                                    statistics.processed_pairs,
+                                                    std::chrono::steady_clock::now() - start_time});
+                    }
+                    if ((status = check_limits(start_time, arena)) != ComputationStatus::Completed) { return; }
+                    ++statistics.processed_pairs;
+                    recorder_.count_pair();
+                    if (are_leading_monomials_coprime(store_[i], store_[j])) {
+                        ++statistics.coprime_pairs;
+                        recorder_.count_coprime_pair();
+                        continue;
+                    }
+                    Polynom p = get_S_polynomial(store_[i], store_[j]);
+                    recorder_.count_s_polynomial_terms(p.size());
+                    if ((status = reduce_within_limits(&p, start_time, arena)) != ComputationStatus::Completed) {
+                        return;
+                    }
+                    recorder_.count_remainder_terms(p.size());
+                    if (p.is_zero()) {
+                        ++statistics.zero_reductions;
+                        recorder_.count_zero_reduction();
+                        continue;
+                    }
+                    insert(std::move(p));
+                    recorder_.observe_basis_size(store_.size());
+                    add_pairs(store_.size() - 1);
+                    --missing;
+                }
+            }
+        });
+        if (is_series_mismatched) {
+            buchberger_state_ = {};
+            return make_groebner_basis_by_pairs();
+        }
+        if (status != ComputationStatus::Completed || is_truncated) { return status; }
+        basis_type_ = BasisType::Groebner;
+        return status;
+    }
+
+    bool is_smallest_variable(const typename Polynom::Monom_::Variable_& h) const {
+        for (const auto& p : store_) {
+            for (const auto& m : p.get_monomials_ascending_order()) {
+                for (const auto& [var, deg] : m.get_variables_ascending_order()) {
+                    if (var < h) { return false; }
+                }
+            }
+        }
+        return true;
+    }
+
+    void invalidate_normal_form_cache() {
+        cache_reducer_.reset();
+        if (normal_form_cache_) { normal_form_cache_->clear(); }
+    }
+
     bool are_all_polynomials_normalized() const {
         for (const auto& p : store_) {
-            if (p.get_highest_monomial().get_coefficient() != 1) return false;
+            if (!p.is_normalized()) return false;
         }
         return true;
     }
 
+    //Polynomials keep their order, of ones with equal leading monomials the last added is kept
     void exclude_unnecessary_polinomials() {
-        for (size_t i = 0; i < store_.size(); ++i) {
-            for (size_t j = 0; j < store_.size(); ++j) {
-                if (i == j) continue;
-                if (are_leading_monomials_divisible(store_[i], store_[j])) {
-                    if (i + 1 != store_.size()) { std::swap(store_[i], store_.back()); }
-                    store_.pop_back();
-                    --i;
-                    break;
+        [[maybe_unused]] auto timer = recorder_.time(instrumentation::ExcludeUnnecessary);
+        auto exponents = get_leading_exponents();
+        //Variables are numbered in order of appearance, so the last vector is the longest
+        size_t variables_count = exponents.empty() ? 0 : exponents.back().size();
+        std::reverse(exponents.begin(), exponents.end());
+        std::vector<size_t> minimal = MonomialIdeal::select_minimal(exponents, variables_count);
+        if (minimal.size() == store_.size()) { return; }
+        for (size_t& i : minimal) { i = store_.size() - 1 - i; }
+        std::reverse(minimal.begin(), minimal.end());
+        for (size_t i = 0; i < minimal.size(); ++i) {
+            if (i != minimal[i]) { store_[i] = std::move(store_[minimal[i]]); }
+        }
+        store_.resize(minimal.size());
+        invalidate_normal_form_cache();
+    }
+
+    //On overflow the polynomial being reduced is restored, so the basis stays a minimal Groebner basis
+    ComputationStatus reduce_each() {
+        [[maybe_unused]] auto timer = recorder_.time(instrumentation::ReduceEach);
+        overflow::reset();
+        ComputationStatus status = ComputationStatus::Completed;
+        run_in_arena([&](const memory::ComputationArena*) {
+            for (size_t i = 0; i < store_.size(); ++i) {
+                Polynom original = std::move(store_[i]);
+                store_.erase(store_.begin() + i);
+                Polynom tmp = original;
+                reduce(&tmp);
+                if (overflow::is_raised()) {
+                    store_.insert(store_.begin() + i, std::move(original));
+                    status = ComputationStatus::ArithmeticOverflow;
+                    return;
                 }
+                store_.insert(store_.begin() + i, std::move(tmp));
             }
-        }
+        });
+        invalidate_normal_form_cache();
+        return status;
+    }
+
+    //Handlers run on the global heap, so copies of polynomials they keep outlive the arena
+    template<typename Handler, typename Argument>
+    static void call_outside_arena(const Handler& handler, const Argument& argument) {
+        memory::ScopedResource scope(nullptr);
+        handler(argument);
     }
 
-    void reduce_each() {
-        for (size_t i = 0; i < store_.size(); ++i) {
-            Polynom tmp = store_[i];
-            store_.erase(store_.begin() + i);
-            Ideal<Polynom> ideal(store_);
-            ideal.reduce(&tmp);
-            store_.insert(store_.begin() + i, tmp);
+    //Polynomials that survive the computation are copied out of the arena before it is destroyed, also when
+    //the computation throws (e.g. from a handler). Computation gets the arena, or nullptr if arenas are disabled.
+    template<typename Computation>
+    void run_in_arena(Computation&& computation) {
+        if (!arena_upstream_) {
+            computation(nullptr);
+            return;
+        }
+        memory::ComputationArena arena(arena_upstream_);
+        try {
+            memory::ScopedResource scope(arena.get_resource());
+            computation(&arena);
+        } catch (...) {
+            rehome_store();
+            throw;
         }
+        rehome_store();
     }
 
-    static bool are_leading_monomials_coprime(const Polynom& p1, const Polynom& p2) {
-        return gcd(p1.get_highest_monomial(), p2.get_highest_monomial()).is_zero();
+    //If copying fails, the basis is dropped rather than left pointing into the arena
+    void rehome_store() {
+        invalidate_normal_form_cache();
+        try {
+            std::vector<Polynom> rehomed(store_.begin(), store_.end());
+            store_ = std::move(rehomed);
+        } catch (...) {
+            store_.clear();
+            basis_type_ = BasisType::Any;
+            throw;
+        }
     }
 
-    static bool are_leading_monomials_divisible(const Polynom& p1, const Polynom& p2) {
-        return p1.get_highest_monomial().is_divisible_on(p2.get_highest_monomial());
+    static bool are_leading_monomials_coprime(const Polynom& p1, const Polynom& p2) {
+        return gcd(p1.get_highest_monomial(), p2.get_highest_monomial()).get_degree() == 0;
     }
 
     std::vector<Polynom> store_;
     BasisType basis_type_ = BasisType::Any;
+    mutable std::optional<NormalFormCache<Polynom>> normal_form_cache_;
+    std::optional<HilbertSeries> hilbert_series_;
+    bool lazy_tail_reduction_ = false;
+    mutable std::optional<Reducer<Polynom>> cache_reducer_;
+    std::pmr::memory_resource* arena_upstream_ = std::pmr::new_delete_resource();
+    BuchbergerState buchberger_state_;
+    std::function<void(const Ideal&)> checkpoint_handler_;
+    CheckpointPolicy checkpoint_policy_;
+    std::function<void(const Progress&)> progress_handler_;
+    uint64_t progress_every_pairs_ = 1;
+    ComputationLimits limits_;
+    std::stop_token stop_token_;
+    [[no_unique_address]] mutable instrumentation::ActiveRecorder recorder_;
 };
@@ -0,0 +1,116 @@
+#pragma once
+#include "UnivariatePolynomial.h"
+#include <map>
+
+//Dense multivariate multiplication over prime fields by Kronecker substitution:
+//x_i -> t^(s_i), where s_i = prod_{j < i} (deg_j(lhs) + deg_j(rhs) + 1), maps both factors to univariate
+//polynomials injectively, so their NTT product is decoded back into the multivariate product.
+namespace kronecker {
+    //Substitution is used only while the univariate product is not longer than this
+    constexpr size_t kMaxDenseSize = 1 << 23;
+    //Measured relative cost of one sparse term product against one butterfly of the transform
+    constexpr size_t kDensityFactor = 16;
+
+    template<typename Polynom>
+    struct Substitution {
+        using Var = typename Polynom::Monom_::Variable_;
+
+        std::vector<Var> variables;
+        std::vector<size_t> strides;
+        size_t size = 1;
+        bool fits = true;
+
+        Substitution(const Polynom& lhs, const Polynom& rhs) {
+            std::map<Var, std::pair<size_t, size_t>> degrees;
+            for (const auto& m : lhs.get_monomials_ascending_order()) {
+                for (const auto& [var, deg] : m.get_variables_ascending_order()) {
+                    degrees[var].first = std::max<size_t>(degrees[var].first, deg);
+                }
+            }
+            for (const auto& m : rhs.get_monomials_ascending_order()) {
+                for (const auto& [var, deg] : m.get_variables_ascending_order()) {
+                    degrees[var].second = std::max<size_t>(degrees[var].second, deg);
+                }
+            }
+            for (const auto& [var, deg] : degrees) {
+                size_t base = deg.first + deg.second + 1;
+                variables.push_back(var);
+                strides.push_back(size);
+                if (size > kMaxDenseSize / base) {
+                    fits = false;
+                    return;
+                }
+                size *= base;
+            }
+        }
+
+        size_t get_index(const typename Polynom::Monom_& m) const {
+            size_t index = 0;
+            for (const auto& [var, deg] : m.get_variables_ascending_order()) {
+                index += strides[std::lower_bound(variables.begin(), variables.end(), var) - variables.begin()] * deg;
+            }
+            return index;
+        }
+
+        UnivariatePolynomial<typename Polynom::Monom_::CoefficientType_> encode(const Polynom& p) const {
+            using CoefficientType = typename Polynom::Monom_::CoefficientType_;
+            std::vector<CoefficientType> coefficients;
+            for (const auto& m : p.get_monomials_ascending_order()) {
+                size_t index = get_index(m);
+                if (coefficients.size() <= index) { coefficients.resize(index + 1, CoefficientType(0)); }
+                coefficients[index] = m.get_coefficient();
+            }
+            return UnivariatePolynomial<CoefficientType>(std::move(coefficients));
+        }
+
+        Polynom decode(const UnivariatePolynomial<typename Polynom::Monom_::CoefficientType_>& p) const {
+            using Monom = typename Polynom::Monom_;
+            Polynom res;
+            const auto& coefficients = p.get_coefficients();
+            for (size_t index = 0; index < coefficients.size(); ++index) {
+                if (coefficients[index] == 0) { continue; }
+                Monom m("1");
+                m *= coefficients[index];
+                for (size_t i = variables.size(), rest = index; i-- > 0;) {
+                    size_t deg = rest / strides[i];
+                    rest %= strides[i];
+                    if (deg) { m *= Monom(1, variables[i], static_cast<typename Monom::DegreeType_>(deg)); }
+                }
+                res += m;
+            }
+            return res;
+        }
+    };
+
+    //Product of polynomials of total size s costs about s * log(s) for transforms,
+    //while sparse product costs a tree insertion for each of the n1 * n2 pairs of terms
+    inline bool is_dense_product_profitable(size_t lhs_terms, size_t rhs_terms, size_t dense_size) {
+        size_t log = 1;
+        while ((size_t(1) << log) < dense_size) { ++log; }
+        return dense_size * log <= kDensityFactor * lhs_terms * rhs_terms;
+    }
+
+    //Chooses between Kronecker substitution with NTT and term-by-term sparse product by density of the factors
+    template<typename Polynom>
+    Polynom multiply(const Polynom& lhs, const Polynom& rhs) {
+        using CoefficientType = typename Polynom::Monom_::CoefficientType_;
+        if constexpr (is_mint<CoefficientType>::value) {
+            if (!lhs.is_zero() && !rhs.is_zero()) {
+                Substitution<Polynom> substitution(lhs, rhs);
+                bool has_roots = (size_t(1) << ntt::RootsOfUnity<CoefficientType>::get().max_log) >= substitution.size;
+                if (substitution.fits && has_roots &&
+                    is_dense_product_profitable(lhs.size(), rhs.size(), substitution.size)) {
+                    return substitution.decode(substitution.encode(lhs) * substitution.encode(rhs));
+                }
+            }
+        }
+        return lhs * rhs;
+    }
+}// namespace kronecker
+
+template<typename Polynom>
+Polynom kronecker_multiply(const Polynom& lhs, const Polynom& rhs) {
+    kronecker::Substitution<Polynom> substitution(lhs, rhs);
+    assert(substitution.fits && "Product is too large for Kronecker substitution");
+    return substitution.decode(substitution.encode(lhs) * substitution.encode(rhs));
+}
@@ -0,0 +1,136 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <memory_resource>
+#include <new>
+
+//Monomials and polynomials take memory for their containers from the current resource of the thread
+//they are created on. By default it's the global heap; ScopedResource redirects it, for example to a ComputationArena.
+namespace memory {
+    //Constant initialization keeps access to the thread-local pointer free of initialization guards,
+    //nullptr stands for the global heap
+    inline std::pmr::memory_resource*& current_resource() {
+        constinit thread_local std::pmr::memory_resource* resource = nullptr;
+        return resource;
+    }
+
+    inline std::pmr::memory_resource* get_current_resource() {
+        std::pmr::memory_resource* resource = current_resource();
+        return resource ? resource : std::pmr::new_delete_resource();
+    }
+
+    class ScopedResource {
+    public:
+        explicit ScopedResource(std::pmr::memory_resource* resource) : previous_(current_resource()) {
+            current_resource() = resource;
+        }
+
+        ScopedResource(const ScopedResource&) = delete;
+        ScopedResource& operator=(const ScopedResource&) = delete;
+
+        ~ScopedResource() { current_resource() = previous_; }
+
+    private:
+        std::pmr::memory_resource* previous_;
+    };
+
+    //Forwards requests to upstream resource, counts them and bytes currently taken from it
+    class CountingResource : public std::pmr::memory_resource {
+    public:
+        explicit CountingResource(std::pmr::memory_resource* upstream) : upstream_(upstream) {}
+
+        size_t get_allocated_bytes() const { return allocated_bytes_; }
+        size_t get_peak_allocated_bytes() const { return peak_allocated_bytes_; }
+        size_t get_allocations_count() const { return allocations_count_; }
+
+    private:
+        void* do_allocate(size_t bytes, size_t alignment) override {
+            void* res = upstream_->allocate(bytes, alignment);
+            allocated_bytes_ += bytes;
+            ++allocations_count_;
+            peak_allocated_bytes_ = std::max(peak_allocated_bytes_, allocated_bytes_);
+            return res;
+        }
+
+        void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+            upstream_->deallocate(p, bytes, alignment);
+            allocated_bytes_ -= bytes;
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+        std::pmr::memory_resource* upstream_;
+        size_t allocated_bytes_ = 0;
+        size_t peak_allocated_bytes_ = 0;
+        size_t allocations_count_ = 0;
+    };
+
+    //Free lists of blocks rounded up to kGranularity bytes, carved from upstream and never returned to it.
+    //Tree nodes of monomials and polynomials fall into a handful of classes, so both operations are O(1).
+    //Blocks larger than kMaxPooledSize are forwarded to upstream as is.
+    class SizeClassPool : public std::pmr::memory_resource {
+    public:
+        static constexpr size_t kGranularity = alignof(std::max_align_t);
+        static constexpr size_t kMaxPooledSize = 512;
+
+        explicit SizeClassPool(std::pmr::memory_resource* upstream) : upstream_(upstream) {}
+
+    private:
+        struct FreeBlock {
+            FreeBlock* next;
+        };
+
+        static size_t get_size_class(size_t bytes) {
+            return (std::max<size_t>(bytes, 1) + kGranularity - 1) / kGranularity;
+        }
+
+        void* do_allocate(size_t bytes, size_t alignment) override {
+            if (bytes > kMaxPooledSize || alignment > kGranularity) { return upstream_->allocate(bytes, alignment); }
+            size_t size_class = get_size_class(bytes);
+            if (FreeBlock* block = free_lists_[size_class]) {
+                free_lists_[size_class] = block->next;
+                return block;
+            }
+            return upstream_->allocate(size_class * kGranularity, kGranularity);
+        }
+
+        void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+            if (bytes > kMaxPooledSize || alignment > kGranularity) {
+                upstream_->deallocate(p, bytes, alignment);
+                return;
+            }
+            size_t size_class = get_size_class(bytes);
+            free_lists_[size_class] = new (p) FreeBlock{free_lists_[size_class]};
+        }
+
+        bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+
+        std::pmr::memory_resource* upstream_;
+        std::array<FreeBlock*, kMaxPooledSize / kGranularity + 1> free_lists_{};
+    };
+
+    //Region for all temporaries of one computation: size-class pool on top of a monotonic buffer.
+    //Freed blocks are reused by the pool, and the whole region goes back to upstream at once on destruction.
+    //Not thread-safe, each thread of a computation needs its own arena.
+    class ComputationArena {
+    public:
+        static constexpr size_t kInitialBufferSize = 1 << 16;
+
+        explicit ComputationArena(std::pmr::memory_resource* upstream = std::pmr::new_delete_resource())
+            : counting_(upstream), monotonic_(kInitialBufferSize, &counting_), pool_(&monotonic_) {}
+
+        ComputationArena(const ComputationArena&) = delete;
+        ComputationArena& operator=(const ComputationArena&) = delete;
+
+        std::pmr::memory_resource* get_resource() { return &pool_; }
+
+        //Bytes taken from upstream so far, the arena never returns them before destruction
+        size_t get_allocated_bytes() const { return counting_.get_allocated_bytes(); }
+
+    private:
+        CountingResource counting_;
+        std::pmr::monotonic_buffer_resource monotonic_;
+        SizeClassPool pool_;
+    };
+}// namespace memory
@@ -0,0 +1,438 @@
+#pragma once
+#include "../Fields/Fraction.h"
+#include "../Fields/Integer.h"
+#include "../Fields/RuntimeMint.h"
+#include "GroebnerTrace.h"
+#include "Serialization.h"
+#include <cerrno>
+#include <cmath>
+#include <poll.h>
+#include <sstream>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+
+//Reduced Groebner bases over the rationals by modular computations. Every prime is handled by a forked worker process,
+//which computes the basis in RuntimeMint arithmetic and sends it back through a pipe in the serialization format with
+//residues stored as 32-bit integers, so a blow-up in one worker doesn't take memory of the others. Images, whose shape
+//(monomials of every polynomial) differs from the most frequent one, come from unlucky primes and are dropped. The rest
+//are combined by Chinese remaindering in 128 bits and rational reconstruction, and the result is accepted once it
+//agrees with images modulo primes not used to build it. This is a probabilistic check, not a proof of correctness.
+//Workers are forked from the calling thread, so the caller mustn't hold locks needed by the computation.
+namespace modular {
+    struct Options {
+        //Number of worker processes run at once
+        size_t workers = std::max(1u, std::thread::hardware_concurrency());
+        //Computation gives up after this number of primes
+        size_t max_primes = 64;
+        //Limits of every worker, zero means no limit
+        std::chrono::milliseconds time_limit{0};
+        size_t memory_limit_bytes = 0;
+        //Learns a trace in the calling process within the limits of a worker, modulo a prime no worker uses.
+        //Workers replay it and check the result by Buchberger's criterion. If learning exceeds the limits,
+        //workers compute their bases without the trace.
+        bool use_trace = false;
+    };
+
+    //Monomial with the same variables and another coefficient type
+    template<typename Monom, typename CoefficientType>
+    struct RebindCoefficient;
+
+    template<typename C, typename VariableOrder, typename DegreeType, typename VariableNumberType,
+             typename CoefficientType>
+    struct RebindCoefficient<Monomial<C, VariableOrder, DegreeType, VariableNumberType>, CoefficientType> {
+        using type = Monomial<CoefficientType, VariableOrder, DegreeType, VariableNumberType>;
+    };
+
+    inline bool is_prime(int64_t n) {
+        if (n < 2) { return false; }
+        for (int64_t d = 2; d * d <= n; ++d) {
+            if (n % d == 0) { return false; }
+        }
+        return true;
+    }
+
+    inline int64_t get_previous_prime(int64_t n) {
+        do { --n; } while (!is_prime(n));
+        return n;
+    }
+
+    template<typename Polynom>
+    class GroebnerBasisBuilder {
+        using Monom = typename Polynom::Monom_;
+        using Order = typename Polynom::MonomialOrder_;
+        using Var = typename Monom::Variable_;
+        using DegreeType = typename Monom::DegreeType_;
+        using CoefficientType = typename Monom::CoefficientType_;
+        using T = decltype(std::declval<CoefficientType>().get_numerator());
+        static_assert(std::is_same_v<CoefficientType, Fraction<T>>, "Coefficients must be rational");
+
+        using Residue = RuntimeMint<int64_t>;
+        using ModularPolynom = Polynomial<typename RebindCoefficient<Monom, Residue>::type, Order>;
+        using TransportPolynom = Polynomial<typename RebindCoefficient<Monom, Integer<int32_t>>::type, Order>;
+        using Powers = std::vector<std::pair<Var, DegreeType>>;
+        using u128 = unsigned __int128;
+        using i128 = __int128;
+
+        //Residues are below 2^31 and CRT moduli below 2^126, so that rational reconstruction works in signed 128 bits
+        static constexpr int64_t kFirstPrime = int64_t(1) << 31;
+        static constexpr u128 kCapacity = u128(1) << 126;
+
+        enum ExitCode { kSuccess = 0, kUnluckyPrime = 1, kLimitsExceeded = 2, kWriteFailed = 3 };
+
+        //Basis modulo prime, sorted by leading monomials
+        struct Image {
+            int64_t prime;
+            std::vector<TransportPolynom> basis;
+        };
+
+        //Images of the same shape: residues of all coefficients modulo the product of primes merged so far
+        struct Group {
+            std::vector<TransportPolynom> shape;
+            std::vector<u128> residues;
+            u128 modulus = 1;
+            size_t images_count = 0;
+        };
+
+        struct Worker {
+            int64_t prime;
+            pid_t pid;
+            int fd;
+            std::string data;
+        };
+
+    public:
+        //Returns nullptr on success or error message
+        const char* build(const std::vector<Polynom>& generators, const Options& options, std::vector<Polynom>* basis) {
+            assert(options.workers > 0);
+            int64_t prime = kFirstPrime;
+            if (options.use_trace) { learn_trace(generators, options, &prime); }
+            for (size_t used = 0; used < options.max_primes;) {
+                std::vector<int64_t> primes;
+                for (; primes.size() < options.workers && used < options.max_primes; ++used) {
+                    primes.push_back(prime = get_previous_prime(prime));
+                }
+                std::vector<Image> images;
+                if (const char* error = run_workers(generators, primes, options, &images)) { return error; }
+                bool is_confirmed = false, is_refuted = false;
+                for (const Image& image : images) {
+                    size_t index = find_group(image);
+                    if (candidate_group_ == index) {
+                        bool agrees = agrees_with(image);
+                        is_confirmed |= agrees;
+                        is_refuted |= !agrees;
+                    }
+                    add_image(&groups_[index], image);
+                }
+                if (is_confirmed && !is_refuted) {
+                    *basis = make_basis();
+                    return nullptr;
+                }
+                if (groups_.empty()) { continue; }
+                size_t largest = 0;
+                for (size_t i = 1; i < groups_.size(); ++i) {
+                    if (groups_[i].images_count > groups_[largest].images_count) { largest = i; }
+                }
+                //No more images are merged into a full group, so it gives the same candidate every time
+                bool is_full = groups_[largest].modulus >= kCapacity / kFirstPrime;
+                bool was_refuted = is_refuted && candidate_group_ == largest;
+                if ((!reconstruct(largest) || was_refuted) && is_full) {
+                    return "Coefficients don't fit into 64-bit fractions";
+                }
+            }
+            return "Reconstruction didn't stabilize within the allowed number of primes";
+        }
+
+    private:
+        static Powers get_powers(const auto& m) {
+            Powers powers;
+            for (const auto& [var, deg] : m.get_variables_ascending_order()) { powers.emplace_back(var, deg); }
+            return powers;
+        }
+
+        static bool is_same_shape(const std::vector<TransportPolynom>& lhs, const std::vector<TransportPolynom>& rhs) {
+            if (lhs.size() != rhs.size()) { return false; }
+            for (size_t i = 0; i < lhs.size(); ++i) {
+                if (lhs[i].size() != rhs[i].size()) { return false; }
+                auto lhs_terms = lhs[i].get_monomials_ascending_order();
+                auto rhs_terms = rhs[i].get_monomials_ascending_order();
+                for (auto it = lhs_terms.begin(), jt = rhs_terms.begin(); it != lhs_terms.end(); ++it, ++jt) {
+                    if (Order()(*it, *jt) || Order()(*jt, *it)) { return false; }
+                }
+            }
+            return true;
+        }
+
+        static int64_t pow_mod(int64_t x, int64_t power, int64_t prime) {
+            int64_t res = 1;
+            for (x %= prime; power; power >>= 1) {
+                if (power & 1) { res = res * x % prime; }
+                x = x * x % prime;
+            }
+            return res;
+        }
+
+        static u128 isqrt(u128 n) {
+            auto x = static_cast<u128>(std::sqrt(static_cast<long double>(n)));
+            while (x * x > n) { --x; }
+            while ((x + 1) * (x + 1) <= n) { ++x; }
+            return x;
+        }
+
+        static i128 gcd(i128 a, i128 b) {
+            while (b) { a = std::exchange(b, a % b); }
+            return a;
+        }
+
+        //n / d with |n|, d <= sqrt(m / 2) congruent to u modulo m, which is unique if exists (Wang's algorithm)
+        static bool reconstruct(u128 u, u128 m, Fraction<T>* res) {
+            i128 bound = isqrt(m / 2);
+            i128 r0 = m, r1 = u, t0 = 0, t1 = 1;
+            while (r1 > bound) {
+                i128 q = r0 / r1;
+                r0 = std::exchange(r1, r0 - q * r1);
+                t0 = std::exchange(t1, t0 - q * t1);
+            }
+            i128 d = t1 < 0 ? -t1 : t1;
+            if (d == 0 || d > bound || gcd(r1, d) != 1) { return false; }
+            if (r1 > std::numeric_limits<T>::max() || d > std::numeric_limits<T>::max()) { return false; }
+            *res = Fraction<T>(static_cast<T>(t1 < 0 ? -r1 : r1), static_cast<T>(d));
+            return true;
+        }
+
+        //Generators modulo the prime set as modulus of Residue, false if the prime divides a denominator
+        static bool make_image(const std::vector<Polynom>& generators, int64_t prime, Ideal<ModularPolynom>* ideal) {
+            for (const Polynom& p : generators) {
+                ModularPolynom image;
+                for (const Monom& m : p.get_monomials_ascending_order()) {
+                    CoefficientType c = m.get_coefficient();
+                    if (c.get_denominator() % prime == 0) { return false; }
+                    Residue residue = Residue(int64_t(c.get_numerator() % prime)) /
+                                      Residue(int64_t(c.get_denominator() % prime));
+                    if (residue != 0) { image.append_highest_monomial({residue, get_powers(m)}); }
+                }
+                ideal->insert(std::move(image));
+            }
+            return true;
+        }
+
+        //Takes primes below *prime until one doesn't divide a denominator and learns modulo it. Workers continue
+        //with primes below *prime, so none of them replays the trace modulo the prime it was learned for.
+        void learn_trace(const std::vector<Polynom>& generators, const Options& options, int64_t* prime) {
+            for (;;) {
+                *prime = get_previous_prime(*prime);
+                Residue::set_modulus(*prime);
+                Ideal<ModularPolynom> ideal;
+                if (!make_image(generators, *prime, &ideal)) { continue; }
+                trace_ = GroebnerTrace<ModularPolynom>::learn(&ideal, {options.time_limit, options.memory_limit_bytes});
+                return;
+            }
+        }
+
+        //Worker body, returns exit code
+        int compute_image(const std::vector<Polynom>& generators, int64_t prime, const Options& options, int fd) const {
+            Residue::set_modulus(prime);
+            Ideal<ModularPolynom> ideal;
+            if (!make_image(generators, prime, &ideal)) { return kUnluckyPrime; }
+            ideal.set_computation_limits({options.time_limit, options.memory_limit_bytes});
+            if (trace_) {
+                trace_->replay(&ideal, true);
+            } else {
+                ideal.make_reduced_groebner_basis();
+            }
+            if (ideal.get_basis_type() != BasisType::ReducedGroebner) { return kLimitsExceeded; }
+            std::vector<TransportPolynom> basis;
+            for (const ModularPolynom& p : ideal.get_basis()) {
+                TransportPolynom& transported = basis.emplace_back();
+                for (const auto& m : p.get_monomials_ascending_order()) {
+                    transported.append_highest_monomial({int32_t(m.get_coefficient().get_value()), get_powers(m)});
+                }
+            }
+            std::sort(basis.begin(), basis.end(), [](const TransportPolynom& p1, const TransportPolynom& p2) {
+                return Order()(p1.get_highest_monomial(), p2.get_highest_monomial());
+            });
+            std::ostringstream os;
+            serialization::Codec<TransportPolynom>::write(os, basis, serialization::Kind::Ideal,
+                                                          BasisType::ReducedGroebner);
+            return write_all(fd, os.str()) ? kSuccess : kWriteFailed;
+        }
+
+        static bool write_all(int fd, std::string_view data) {
+            while (!data.empty()) {
+                ssize_t written = write(fd, data.data(), data.size());
+                if (written < 0 && errno == EINTR) { continue; }
+                if (written <= 0) { return false; }
+                data.remove_prefix(written);
+            }
+            return true;
+        }
+
+        //Reads pipes of all workers until they are closed
+        static void collect_output(std::vector<Worker>* workers) {
+            std::vector<pollfd> fds;
+            for (const Worker& worker : *workers) { fds.push_back({worker.fd, POLLIN, 0}); }
+            size_t open_count = fds.size();
+            char buffer[1 << 16];
+            while (open_count > 0) {
+                if (poll(fds.data(), fds.size(), -1) < 0) {
+                    if (errno == EINTR) { continue; }
+                    break;
+                }
+                for (size_t i = 0; i < fds.size(); ++i) {
+                    if (fds[i].fd < 0 || !fds[i].revents) { continue; }
+                    ssize_t bytes = read(fds[i].fd, buffer, sizeof(buffer));
+                    if (bytes > 0) {
+                        (*workers)[i].data.append(buffer, bytes);
+                    } else if (bytes == 0 || errno != EINTR) {
+                        close(fds[i].fd);
+                        fds[i].fd = -1;
+                        --open_count;
+                    }
+                }
+            }
+            for (const pollfd& fd : fds) {
+                if (fd.fd >= 0) { close(fd.fd); }
+            }
+        }
+
+        //Images of bases modulo primes, unlucky primes dividing a denominator of the input are skipped
+        const char* run_workers(const std::vector<Polynom>& generators, const std::vector<int64_t>& primes,
+                                const Options& options, std::vector<Image>* images) const {
+            const char* error = nullptr;
+            std::vector<Worker> workers;
+            for (int64_t prime : primes) {
+                int fds[2];
+                if (pipe(fds) != 0) {
+                    error = "Can't create a pipe";
+                    break;
+                }
+                pid_t pid = fork();
+                if (pid < 0) {
+                    close(fds[0]);
+                    close(fds[1]);
+                    error = "Can't start a worker process";
+                    break;
+                }
+                if (pid == 0) {
+                    close(fds[0]);
+                    for (const Worker& worker : workers) { close(worker.fd); }
+                    //Skips destructors and flushing of buffers shared with the parent
+                    _exit(compute_image(generators, prime, options, fds[1]));
+                }
+                close(fds[1]);
+                workers.push_back({prime, pid, fds[0], {}});
+            }
+            collect_output(&workers);
+            for (Worker& worker : workers) {
+                int status = 0;
+                while (waitpid(worker.pid, &status, 0) < 0 && errno == EINTR) {}
+                if (!WIFEXITED(status)) {
+                    error = error ? error : "Worker process was terminated";
+                    continue;
+                }
+                if (int code = WEXITSTATUS(status); code != kSuccess) {
+                    if (code == kLimitsExceeded) { error = error ? error : "Worker exceeded computation limits"; }
+                    if (code == kWriteFailed) { error = error ? error : "Worker can't send its basis"; }
+                    continue;
+                }
+                std::istringstream is(std::move(worker.data));
+                Image& image = images->emplace_back(worker.prime);
+                BasisType basis_type;
+                if (serialization::Codec<TransportPolynom>::read(is, serialization::Kind::Ideal, &image.basis,
+                                                                 &basis_type)) {
+                    images->pop_back();
+                    error = error ? error : "Worker sent malformed basis";
+                }
+            }
+            return error;
+        }
+
+        size_t find_group(const Image& image) {
+            for (size_t i = 0; i < groups_.size(); ++i) {
+                if (is_same_shape(groups_[i].shape, image.basis)) { return i; }
+            }
+            groups_.push_back({image.basis, std::vector<u128>(get_terms_count(image.basis)), 1, 0});
+            return groups_.size() - 1;
+        }
+
+        static size_t get_terms_count(const std::vector<TransportPolynom>& basis) {
+            size_t count = 0;
+            for (const auto& p : basis) { count += p.size(); }
+            return count;
+        }
+
+        //x = a + M * ((b - a) / M mod p) is the only solution below M * p of x = a mod M, x = b mod p.
+        //Images beyond the capacity are only counted and used for checks.
+        static void add_image(Group* group, const Image& image) {
+            ++group->images_count;
+            int64_t p = image.prime;
+            if (group->modulus >= kCapacity / p) { return; }
+            int64_t modulus_inverse = pow_mod(int64_t(group->modulus % p), p - 2, p);
+            size_t k = 0;
+            for (const auto& poly : image.basis) {
+                for (const auto& m : poly.get_monomials_ascending_order()) {
+                    u128& a = group->residues[k++];
+                    int64_t b = m.get_coefficient().get_value();
+                    int64_t difference = ((b - int64_t(a % p)) % p + p) % p;
+                    a += group->modulus * u128(difference * modulus_inverse % p);
+                }
+            }
+            group->modulus *= p;
+        }
+
+        //Candidate from the group, false if some coefficient can't be reconstructed yet
+        bool reconstruct(size_t index) {
+            const Group& group = groups_[index];
+            candidate_group_ = SIZE_MAX;
+            candidate_.resize(group.residues.size());
+            for (size_t k = 0; k < group.residues.size(); ++k) {
+                if (!reconstruct(group.residues[k], group.modulus, &candidate_[k])) { return false; }
+            }
+            candidate_group_ = index;
+            return true;
+        }
+
+        bool agrees_with(const Image& image) const {
+            size_t k = 0;
+            for (const auto& poly : image.basis) {
+                for (const auto& m : poly.get_monomials_ascending_order()) {
+                    const Fraction<T>& c = candidate_[k++];
+                    i128 difference = i128(c.get_numerator()) - i128(m.get_coefficient().get_value()) *
+                                                                    i128(c.get_denominator());
+                    if (difference % image.prime != 0) { return false; }
+                }
+            }
+            return true;
+        }
+
+        std::vector<Polynom> make_basis() const {
+            std::vector<Polynom> basis;
+            size_t k = 0;
+            for (const auto& poly : groups_[candidate_group_].shape) {
+                Polynom& p = basis.emplace_back();
+                for (const auto& m : poly.get_monomials_ascending_order()) {
+                    p.append_highest_monomial(Monom(candidate_[k++], get_powers(m)));
+                }
+            }
+            return basis;
+        }
+
+        std::vector<Group> groups_;
+        std::vector<Fraction<T>> candidate_;
+        size_t candidate_group_ = SIZE_MAX;
+        std::optional<GroebnerTrace<ModularPolynom>> trace_;
+    };
+
+    //Replaces basis of the ideal with its reduced Groebner basis over the rationals. Limits, progress and checkpoints
+    //of Ideal aren't used. Returns nullptr on success or error message, then the ideal is left unchanged.
+    template<typename Polynom>
+    const char* make_reduced_groebner_basis(Ideal<Polynom>* ideal, const Options& options = {}) {
+        if (ideal->get_basis_type() == BasisType::ReducedGroebner) { return nullptr; }
+        std::vector<Polynom> basis;
+        if (const char* error = GroebnerBasisBuilder<Polynom>().build(ideal->get_basis(), options, &basis)) {
+            return error;
+        }
+        ideal->assign_basis(std::move(basis), BasisType::ReducedGroebner);
+        return nullptr;
+    }
+}// namespace modular
@@ -1,7 +1,9 @@
 #pragma once
 #include "../Orders/MonomialOrders.h"
 #include "../Parsers/MonomialParser.h"
+#include "MemoryArena.h"
 #include <iostream>
+#include <span>
 
 template<typename Iterator>
 class Proxy {
@@ -20,8 +22,7 @@ public:
         bool operator!=(const ProxyIterator& rhs) const { return iterator_ != rhs.iterator_; }
         bool operator==(const ProxyIterator& rhs) const { return iterator_ == rhs.iterator_; }
 
-        auto operator*() { return *iterator_; }
-        const auto operator*() const { return *iterator_; }
+        decltype(auto) operator*() const { return *iterator_; }
 
     private:
         Iterator iterator_;
@@ -43,22 +44,54 @@ template<typename CoefficientType, typename VariableOrder = VariableOrders::Asci
          typename VariableNumberType = int32_t>
 class Monomial {
     using Var = Variable<VariableNumberType, VariableOrder>;
+    using VariableStore = std::pmr::map<Var, DegreeType>;
 
 public:
     using CoefficientType_ = CoefficientType;
     using DegreeType_ = DegreeType;
+    using Variable_ = Var;
 
     Monomial() = default;
 
-    explicit Monomial(std::string s) {
+    //Copies take memory from the current resource, moves keep the resource of the source
+    Monomial(const Monomial& rhs) : Monomial(rhs, memory::get_current_resource()) {}
+
+    Monomial(const Monomial& rhs, std::pmr::memory_resource* resource)
+        : coefficient_(rhs.coefficient_), var_store_(rhs.var_store_, resource) {}
+
+    Monomial(Monomial&& rhs) = default;
+    Monomial& operator=(const Monomial& rhs) = default;
+    Monomial& operator=(Monomial&& rhs) = default;
+
+    explicit Monomial(const std::string& s) {
         MonomialParser<CoefficientType, VariableOrder, DegreeType, VariableNumberType> parser;
         parser.parse(s, &coefficient_, &var_store_);
         simplify();
     }
 
+    //Reads monomial starting at *pos into res, returns nullptr or error message as MonomialParser does
+    static const char* parse(std::string_view s, size_t* pos, Monomial* res) {
+        res->coefficient_ = 0;
+        res->var_store_.clear();
+        MonomialParser<CoefficientType, VariableOrder, DegreeType, VariableNumberType> parser;
+        const char* error = parser.parse(s, pos, &res->coefficient_, &res->var_store_);
+        res->simplify();
+        return error;
+    }
+
     Monomial(CoefficientType coefficient, Var var, DegreeType deg) : coefficient_(std::move(coefficient)) {
         assert(deg >= 0);
-        if (coefficient != 0 && deg >= 0) { var_store_[var] = deg; }
+        if (coefficient_ != 0 && deg > 0) { var_store_[var] = deg; }
+    }
+
+    //Variables must go in increasing order, zero degrees are skipped
+    Monomial(CoefficientType coefficient, std::span<const std::pair<Var, DegreeType>> variables)
+        : coefficient_(std::move(coefficient)) {
+        if (coefficient_ == 0) { return; }
+        for (const auto& [var, deg] : variables) {
+            assert(deg >= 0);
+            if (deg > 0) { var_store_.emplace_hint(var_store_.end(), var, deg); }
+        }
     }
 
     Monomial& operator*=(const Monomial& rhs) {
@@ -160,11 +193,11 @@ public:
         return ans;
     }
 
-    Proxy<typename std::map<Var, DegreeType>::const_iterator> get_variables_ascending_order() const {
+    Proxy<typename VariableStore::const_iterator> get_variables_ascending_order() const {
         return Proxy(var_store_.begin(), var_store_.end());
     }
 
-    Proxy<typename std::map<Var, DegreeType>::const_reverse_iterator> get_variables_descending_order() const {
+    Proxy<typename VariableStore::const_reverse_iterator> get_variables_descending_order() const {
         return Proxy(var_store_.rbegin(), var_store_.rend());
     }
 
@@ -230,12 +263,12 @@ private:
         }
     }
 
-    Monomial(const CoefficientType& coefficient, const std::map<Var, DegreeType>& var_store)
-        : coefficient_(coefficient), var_store_(var_store) {
+    Monomial(const CoefficientType& coefficient, const VariableStore& var_store)
+        : coefficient_(coefficient), var_store_(var_store, memory::get_current_resource()) {
         for (const auto& [var, deg] : var_store_) { assert(deg >= 0 && "Variable degree must be non-negative"); }
         simplify();
     }
 
     CoefficientType coefficient_ = 0;
-    std::map<Var, DegreeType> var_store_;
+    VariableStore var_store_{memory::get_current_resource()};
 };
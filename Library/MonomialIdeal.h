@@ -0,0 +1,246 @@
+#pragma once
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+//Ideal of K[x_0, ..., x_{n-1}] generated by monomials given as exponent vectors, missing exponents are zero.
+//Generators are kept minimal. They are leaves of a trie over exponents of x_0, ..., x_{n-1}, whose children are
+//sorted by exponent, so a divisor search visits only branches with exponents not greater than the query's.
+//Every node also keeps divisor masks of its subtree (bit i % 64 is set for a positive exponent of x_i):
+//bits common to all its generators and bits present in any of them, which cut off most of the branches.
+class MonomialIdeal {
+public:
+    using Exponents = std::vector<int64_t>;
+
+    explicit MonomialIdeal(size_t variables_count = 0) : variables_count_(variables_count), nodes_(1) {}
+
+    MonomialIdeal(const std::vector<Exponents>& generators, size_t variables_count) : MonomialIdeal(variables_count) {
+        add_minimal(generators);
+    }
+
+    //Indices of a minimal generating subset in increasing order, the first of equal monomials is kept
+    static std::vector<size_t> select_minimal(const std::vector<Exponents>& monomials, size_t variables_count) {
+        std::vector<size_t> minimal = MonomialIdeal(variables_count).add_minimal(monomials);
+        std::sort(minimal.begin(), minimal.end());
+        return minimal;
+    }
+
+    static int64_t get_degree(const Exponents& m) { return std::accumulate(m.begin(), m.end(), int64_t(0)); }
+
+    size_t get_variables_count() const { return variables_count_; }
+
+    size_t size() const { return size_; }
+
+    bool empty() const { return size_ == 0; }
+
+    //Minimal generators in increasing degree
+    std::vector<Exponents> get_generators() const {
+        std::vector<const Entry*> alive;
+        for (const Entry& entry : entries_) {
+            if (entry.is_alive) { alive.push_back(&entry); }
+        }
+        std::stable_sort(alive.begin(), alive.end(),
+                         [](const Entry* e1, const Entry* e2) { return e1->degree < e2->degree; });
+        std::vector<Exponents> res;
+        for (const Entry* entry : alive) { res.push_back(entry->exponents); }
+        return res;
+    }
+
+    //Generator dividing m or nullptr if m isn't in the ideal
+    const Exponents* find_divisor(const Exponents& m) const {
+        assert(m.size() <= variables_count_);
+        size_t index = find_divisor(0, 0, m, get_mask(m));
+        return index == kNone ? nullptr : &entries_[index].exponents;
+    }
+
+    bool contains(const Exponents& m) const { return find_divisor(m) != nullptr; }
+
+    //Adds m unless it's already in the ideal, generators divisible by m are removed.
+    //Returns whether the ideal has changed.
+    bool insert(Exponents m) {
+        if (contains(m)) { return false; }
+        m.resize(variables_count_);
+        std::vector<size_t> multiples;
+        find_multiples(0, 0, m, get_mask(m), &multiples);
+        for (size_t index : multiples) {
+            entries_[index].is_alive = false;
+            nodes_[entries_[index].leaf].generator = kNone;
+            --size_;
+        }
+        add(std::move(m));
+        //Removed generators leave their paths in the trie until there are more of them than alive ones
+        if (entries_.size() > 2 * size_) { *this = MonomialIdeal(get_generators(), variables_count_); }
+        return true;
+    }
+
+    //(I : m) is generated by g / gcd(g, m) for generators g of I
+    MonomialIdeal colon(const Exponents& m) const {
+        assert(m.size() <= variables_count_);
+        std::vector<Exponents> quotients;
+        for (const Entry& entry : entries_) {
+            if (!entry.is_alive) { continue; }
+            Exponents& q = quotients.emplace_back(entry.exponents);
+            for (size_t i = 0; i < m.size(); ++i) { q[i] = std::max<int64_t>(q[i] - m[i], 0); }
+        }
+        return MonomialIdeal(quotients, variables_count_);
+    }
+
+    //Finitely many standard monomials: the ideal is the whole ring or every variable has a pure power among generators
+    bool is_zero_dimensional() const {
+        if (contains(Exponents(variables_count_))) { return true; }
+        std::vector<bool> has_pure_power(variables_count_);
+        for (const Entry& entry : entries_) {
+            if (!entry.is_alive) { continue; }
+            const Exponents& e = entry.exponents;
+            if (std::count(e.begin(), e.end(), 0) + 1 == int64_t(variables_count_)) {
+                has_pure_power[std::find_if(e.begin(), e.end(), [](int64_t x) { return x > 0; }) - e.begin()] = true;
+            }
+        }
+        return std::find(has_pure_power.begin(), has_pure_power.end(), false) == has_pure_power.end();
+    }
+
+    //Calls visit(monomial, parent, variable) for monomials outside of the ideal of degree at most max_degree,
+    //in increasing degree. Every monomial but 1 is the earlier visited monomial number parent times x_variable,
+    //parent of 1 is SIZE_MAX. Standard monomials are closed under division, so the parent is obtained by
+    //decrementing the last positive exponent, and every monomial is generated exactly once.
+    //Returns false without visiting anything if the degree is unbounded and there are infinitely many of them.
+    template<typename Visitor>
+    bool for_each_standard_monomial(int64_t max_degree, Visitor&& visit) const {
+        if (max_degree == INT64_MAX && !is_zero_dimensional()) { return false; }
+        Exponents unit(variables_count_);
+        if (contains(unit)) { return true; }
+        visit(unit, SIZE_MAX, size_t(0));
+        std::vector<std::pair<Exponents, size_t>> layer = {{std::move(unit), 0}}, next_layer;
+        size_t count = 1;
+        for (int64_t degree = 1; degree <= max_degree && !layer.empty(); ++degree) {
+            next_layer.clear();
+            for (const auto& [m, index] : layer) {
+                size_t last = m.size();
+                while (last > 0 && m[last - 1] == 0) { --last; }
+                for (size_t v = last == 0 ? 0 : last - 1; v < variables_count_; ++v) {
+                    Exponents product = m;
+                    ++product[v];
+                    if (contains(product)) { continue; }
+                    visit(product, index, v);
+                    next_layer.emplace_back(std::move(product), count++);
+                }
+            }
+            std::swap(layer, next_layer);
+        }
+        return true;
+    }
+
+    //Monomials outside of the ideal of degree at most max_degree, in increasing degree.
+    //Empty if the degree is unbounded and there are infinitely many of them, see is_zero_dimensional
+    std::vector<Exponents> get_standard_monomials(int64_t max_degree = INT64_MAX) const {
+        std::vector<Exponents> res;
+        for_each_standard_monomial(max_degree, [&res](const Exponents& m, size_t, size_t) { res.push_back(m); });
+        return res;
+    }
+
+private:
+    static constexpr size_t kNone = SIZE_MAX;
+
+    struct Node {
+        //Sorted by exponent
+        std::vector<std::pair<int64_t, uint32_t>> children;
+        uint64_t common_mask = ~uint64_t(0);
+        uint64_t any_mask = 0;
+        //Index of entry for leaves, kNone for inner nodes and removed generators
+        size_t generator = kNone;
+    };
+
+    struct Entry {
+        Exponents exponents;
+        int64_t degree;
+        uint32_t leaf;
+        bool is_alive;
+    };
+
+    static uint64_t get_mask(const Exponents& m) {
+        uint64_t mask = 0;
+        for (size_t i = 0; i < m.size(); ++i) {
+            if (m[i] > 0) { mask |= uint64_t(1) << (i % 64); }
+        }
+        return mask;
+    }
+
+    static int64_t get_exponent(const Exponents& m, size_t i) { return i < m.size() ? m[i] : 0; }
+
+    //Monomials are processed in increasing degree, then only earlier ones can divide them.
+    //Returns indices of added ones.
+    std::vector<size_t> add_minimal(const std::vector<Exponents>& monomials) {
+        std::vector<int64_t> degrees(monomials.size());
+        std::transform(monomials.begin(), monomials.end(), degrees.begin(), get_degree);
+        std::vector<size_t> order(monomials.size());
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(),
+                         [&degrees](size_t i, size_t j) { return degrees[i] < degrees[j]; });
+        std::vector<size_t> added;
+        for (size_t i : order) {
+            if (contains(monomials[i])) { continue; }
+            add(monomials[i]);
+            added.push_back(i);
+        }
+        return added;
+    }
+
+    //m mustn't be in the ideal
+    void add(Exponents m) {
+        assert(m.size() <= variables_count_);
+        m.resize(variables_count_);
+        uint64_t mask = get_mask(m);
+        uint32_t node = 0;
+        for (size_t depth = 0;; ++depth) {
+            nodes_[node].common_mask &= mask;
+            nodes_[node].any_mask |= mask;
+            if (depth == variables_count_) { break; }
+            auto& children = nodes_[node].children;
+            auto it = std::lower_bound(children.begin(), children.end(), std::pair<int64_t, uint32_t>(m[depth], 0));
+            if (it == children.end() || it->first != m[depth]) {
+                it = children.insert(it, {m[depth], uint32_t(nodes_.size())});
+                //Reference to children is invalidated here
+                node = it->second;
+                nodes_.emplace_back();
+            } else {
+                node = it->second;
+            }
+        }
+        nodes_[node].generator = entries_.size();
+        entries_.push_back({std::move(m), 0, node, true});
+        entries_.back().degree = get_degree(entries_.back().exponents);
+        ++size_;
+    }
+
+    size_t find_divisor(uint32_t node, size_t depth, const Exponents& m, uint64_t mask) const {
+        const Node& current = nodes_[node];
+        if (current.common_mask & ~mask) { return kNone; }
+        if (depth == variables_count_) { return current.generator; }
+        int64_t exponent = get_exponent(m, depth);
+        for (const auto& [e, child] : current.children) {
+            if (e > exponent) { break; }
+            if (size_t index = find_divisor(child, depth + 1, m, mask); index != kNone) { return index; }
+        }
+        return kNone;
+    }
+
+    void find_multiples(uint32_t node, size_t depth, const Exponents& m, uint64_t mask,
+                        std::vector<size_t>* multiples) const {
+        const Node& current = nodes_[node];
+        if (mask & ~current.any_mask) { return; }
+        if (depth == variables_count_) {
+            if (current.generator != kNone) { multiples->push_back(current.generator); }
+            return;
+        }
+        auto it = std::lower_bound(current.children.begin(), current.children.end(),
+                                   std::pair<int64_t, uint32_t>(m[depth], 0));
+        for (; it != current.children.end(); ++it) { find_multiples(it->second, depth + 1, m, mask, multiples); }
+    }
+
+    size_t variables_count_;
+    size_t size_ = 0;
+    std::vector<Node> nodes_;
+    std::vector<Entry> entries_;
+};
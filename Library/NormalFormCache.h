@@ -0,0 +1,128 @@
+#pragma once
+#include "Reducer.h"
+#include <list>
+#include <map>
+#include <utility>
+
+//Memoized normal forms of monic monomials modulo a fixed basis.
+//Normal form of a polynomial is assembled as a linear combination of cached monomial normal forms.
+//Least recently used entries are evicted once the total number of stored monomials exceeds the limit.
+template<typename Polynom>
+class NormalFormCache {
+    using Monom = typename Polynom::Monom_;
+    using MonomialOrder = typename Polynom::MonomialOrder_;
+
+    struct Entry {
+        Polynom normal_form;
+        typename std::list<Monom>::iterator usage_position;
+    };
+
+public:
+    static constexpr size_t kDefaultMaxTerms = 1 << 20;
+
+    struct Statistics {
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t evictions = 0;
+        size_t entries = 0;
+        size_t terms = 0;
+    };
+
+    //Normal forms of monomials are combined linearly, which fraction-free reduction over the integers doesn't allow
+    explicit NormalFormCache(size_t max_terms = kDefaultMaxTerms) : max_terms_(max_terms) {
+        static_assert(!is_integer<typename Monom::CoefficientType_>::value, "Normal forms are cached over fields");
+    }
+
+    //Entries keep iterators into usage_order_, so a copy rebuilds the list and points them to its own nodes
+    NormalFormCache(const NormalFormCache& rhs) : max_terms_(rhs.max_terms_), statistics_(rhs.statistics_) {
+        for (const Monom& m : rhs.usage_order_) {
+            usage_order_.push_back(m);
+            store_.emplace(m, Entry{rhs.store_.find(m)->second.normal_form, std::prev(usage_order_.end())});
+        }
+    }
+
+    NormalFormCache& operator=(const NormalFormCache& rhs) {
+        if (this != &rhs) {
+            NormalFormCache copy(rhs);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    //Moved nodes of std::list stay valid, so do the iterators
+    NormalFormCache(NormalFormCache&&) = default;
+    NormalFormCache& operator=(NormalFormCache&&) = default;
+
+    Polynom normal_form(const Polynom& p, const Reducer<Polynom>& reducer) {
+        Polynom result;
+        for (const Monom& m : p.get_monomials_descending_order()) {
+            result += get_monomial_normal_form(monic(m), reducer) * m.get_coefficient();
+        }
+        return result;
+    }
+
+    void clear() {
+        store_.clear();
+        usage_order_.clear();
+        statistics_.entries = statistics_.terms = 0;
+    }
+
+    void set_max_terms(size_t max_terms) {
+        max_terms_ = max_terms;
+        evict();
+    }
+
+    const Statistics& get_statistics() const { return statistics_; }
+
+private:
+    static Monom monic(const Monom& m) { return m / m.get_coefficient(); }
+
+    //m must be monic. Returned value is a copy because computing other entries may evict this one.
+    Polynom get_monomial_normal_form(const Monom& m, const Reducer<Polynom>& reducer) {
+        if (auto it = store_.find(m); it != store_.end()) {
+            ++statistics_.hits;
+            usage_order_.splice(usage_order_.begin(), usage_order_, it->second.usage_position);
+            return it->second.normal_form;
+        }
+        ++statistics_.misses;
+        Polynom result;
+        if (const Polynom* g = reducer.find_reducer(m)) {
+            //m = (m / lm(g)) * g - (m / lm(g)) * tail(g), where all tail monomials are smaller than m
+            Monom multiplier = m / g->get_highest_monomial();
+            bool is_leading = true;
+            for (const Monom& g_monomial : g->get_monomials_descending_order()) {
+                if (std::exchange(is_leading, false)) { continue; }
+                Monom term = g_monomial * multiplier;
+                result -= get_monomial_normal_form(monic(term), reducer) * term.get_coefficient();
+            }
+        } else {
+            result = Polynom(m);
+        }
+        insert(m, result);
+        return result;
+    }
+
+    void insert(const Monom& m, const Polynom& normal_form) {
+        usage_order_.push_front(m);
+        store_.emplace(m, Entry{normal_form, usage_order_.begin()});
+        ++statistics_.entries;
+        statistics_.terms += normal_form.size() + 1;
+        evict();
+    }
+
+    void evict() {
+        while (statistics_.terms > max_terms_ && !usage_order_.empty()) {
+            auto it = store_.find(usage_order_.back());
+            statistics_.terms -= it->second.normal_form.size() + 1;
+            --statistics_.entries;
+            ++statistics_.evictions;
+            store_.erase(it);
+            usage_order_.pop_back();
+        }
+    }
+
+    std::map<Monom, Entry, MonomialOrder> store_;
+    std::list<Monom> usage_order_;
+    size_t max_terms_;
+    Statistics statistics_;
+};
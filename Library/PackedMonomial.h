@@ -0,0 +1,350 @@
+#pragma once
+#include "../Fields/Overflow.h"
+#include "Polynomial.h"
+#include <array>
+
+//Order of exponent lanes after the degree field. Grlex puts x_0 first, which also suits Lex,
+//Grevlex puts x_{N-1} first. Orders the layout was built for compare monomials as unsigned words.
+enum class PackedLayout { Grlex, Grevlex };
+
+//Monomial in a fixed set of variables x_0, ..., x_{kVariables - 1} (x_0 is the greatest one) with exponents
+//packed into lanes of 64-bit words. Nothing is allocated, and multiplication, division and divisibility check
+//work on whole words. Variable names can use another letter, e.g. a_0, a_1.
+//Total degree is kept in the top field of the first word, at least 16 bits wide, and changes with the exponents.
+//Exponents must stay below 2^(bits of ExponentType - 1): the top bit of every field is a guard, which catches
+//overflow on multiplication and keeps borrows of subtraction from crossing lanes. Overflowing multiplication
+//raises overflow::flag() and leaves the product unspecified, see Fields/Overflow.h.
+template<typename CoefficientType, size_t kVariables, typename ExponentType = uint8_t,
+         PackedLayout kLayout = PackedLayout::Grlex, char kLetter = 'x'>
+class PackedMonomial {
+    static_assert(kVariables > 0);
+    static_assert(std::is_unsigned_v<ExponentType> && sizeof(ExponentType) <= 4);
+
+    static constexpr size_t kLaneBits = 8 * sizeof(ExponentType);
+    static constexpr size_t kLanesPerWord = 64 / kLaneBits;
+    static constexpr size_t kDegreeLanes = kLaneBits >= 16 ? 1 : 16 / kLaneBits;
+    static constexpr size_t kWords = (kDegreeLanes + kVariables + kLanesPerWord - 1) / kLanesPerWord;
+
+    static constexpr uint64_t repeat_in_lanes(uint64_t value) {
+        uint64_t res = 0;
+        for (size_t i = 0; i < kLanesPerWord; ++i) { res |= value << (i * kLaneBits); }
+        return res;
+    }
+
+    static constexpr uint64_t kLaneMask = (uint64_t(1) << kLaneBits) - 1;
+    static constexpr size_t kDegreeShift = 64 - kDegreeLanes * kLaneBits;
+    static constexpr uint64_t kDegreeMask = ~uint64_t(0) << kDegreeShift;
+    static constexpr uint64_t kLaneGuards = repeat_in_lanes(uint64_t(1) << (kLaneBits - 1));
+
+    //Guard bits and exponent lanes of word w, the first word also holds the degree field
+    static constexpr uint64_t get_guards(size_t w) {
+        return w ? kLaneGuards : (kLaneGuards & ~kDegreeMask) | (uint64_t(1) << 63);
+    }
+    static constexpr uint64_t get_lanes(size_t w) { return w ? ~uint64_t(0) : ~kDegreeMask; }
+
+    using Words = std::array<uint64_t, kWords>;
+
+public:
+    using CoefficientType_ = CoefficientType;
+    using DegreeType_ = int64_t;
+    using Variable_ = Variable<int32_t>;
+
+    static constexpr DegreeType_ kMaxExponent = (DegreeType_(1) << (kLaneBits - 1)) - 1;
+    static constexpr DegreeType_ kMaxDegree = (DegreeType_(1) << (kDegreeLanes * kLaneBits - 1)) - 1;
+
+private:
+    using Var = Variable_;
+    using DegreeType = DegreeType_;
+
+    //Iterates over variables with nonzero exponents as (variable, exponent) pairs
+    class VariableIterator {
+    public:
+        VariableIterator(const PackedMonomial* monomial, size_t index, bool descending)
+            : monomial_(monomial), index_(index), descending_(descending) {
+            skip_zeros();
+        }
+
+        VariableIterator& operator++() {
+            ++index_;
+            skip_zeros();
+            return *this;
+        }
+
+        bool operator!=(const VariableIterator& rhs) const { return index_ != rhs.index_; }
+        bool operator==(const VariableIterator& rhs) const { return index_ == rhs.index_; }
+
+        std::pair<Var, DegreeType> operator*() const {
+            size_t variable = descending_ ? index_ : kVariables - 1 - index_;
+            return {Var(kLetter, variable), monomial_->get_exponent(variable)};
+        }
+
+    private:
+        void skip_zeros() {
+            while (index_ < kVariables && !monomial_->get_exponent(descending_ ? index_ : kVariables - 1 - index_)) {
+                ++index_;
+            }
+        }
+
+        const PackedMonomial* monomial_;
+        size_t index_;
+        bool descending_;
+    };
+
+public:
+    PackedMonomial() = default;
+
+    //Memory resource is accepted for compatibility with Monomial, packed monomials don't allocate
+    PackedMonomial(const PackedMonomial& rhs, std::pmr::memory_resource*) : PackedMonomial(rhs) {}
+
+    explicit PackedMonomial(const std::string& s) {
+        size_t pos = 0;
+        [[maybe_unused]] const char* error = parse(s, &pos, this);
+        assert(error == nullptr && "Bad monomial");
+        assert(pos == s.size() && "Unexpected character in monomial");
+    }
+
+    //Reads monomial starting at *pos into res, returns nullptr or error message as MonomialParser does
+    static const char* parse(std::string_view s, size_t* pos, PackedMonomial* res) {
+        *res = PackedMonomial();
+        std::pmr::map<Var, DegreeType> variables;
+        MonomialParser<CoefficientType, VariableOrders::AsciiOrder, DegreeType, int32_t> parser;
+        if (const char* error = parser.parse(s, pos, &res->coefficient_, &variables)) { return error; }
+        if (res->coefficient_ == 0) { return nullptr; }
+        for (const auto& [var, deg] : variables) {
+            if (var.get_letter() != kLetter || var.get_number() < 0 || size_t(var.get_number()) >= kVariables) {
+                return "Variable is out of the packed monomial";
+            }
+            if (deg > kMaxExponent) { return "Exponent is too large for the packed monomial"; }
+            res->set_exponent(var.get_number(), deg);
+        }
+        return nullptr;
+    }
+
+    PackedMonomial(CoefficientType coefficient, Var var, DegreeType deg) : coefficient_(std::move(coefficient)) {
+        assert(deg >= 0);
+        if (coefficient_ != 0) { set_exponent(get_index(var), deg); }
+    }
+
+    //Variables must go in increasing order, zero degrees are skipped
+    PackedMonomial(CoefficientType coefficient, std::span<const std::pair<Var, DegreeType>> variables)
+        : coefficient_(std::move(coefficient)) {
+        if (coefficient_ == 0) { return; }
+        for (const auto& [var, deg] : variables) {
+            assert(deg >= 0);
+            set_exponent(get_index(var), deg);
+        }
+    }
+
+    PackedMonomial& operator*=(const PackedMonomial& rhs) {
+        *this *= rhs.coefficient_;
+        if (is_zero()) { return *this; }
+        for (size_t w = 0; w < kWords; ++w) { words_[w] += rhs.words_[w]; }
+        if (has_overflow()) { overflow::raise(); }
+        return *this;
+    }
+    friend PackedMonomial operator*(PackedMonomial lhs, const PackedMonomial& rhs) { return lhs *= rhs; }
+
+    PackedMonomial& operator*=(const Var& rhs) {
+        if (is_zero()) { return *this; }
+        size_t index = get_index(rhs);
+        if (get_exponent(index) == kMaxExponent || get_degree() == kMaxDegree) {
+            overflow::raise();
+            return *this;
+        }
+        set_exponent(index, get_exponent(index) + 1);
+        return *this;
+    }
+    friend PackedMonomial operator*(PackedMonomial lhs, const Var& rhs) { return lhs *= rhs; }
+    friend PackedMonomial operator*(const Var& lhs, PackedMonomial rhs) { return rhs *= lhs; }
+
+    PackedMonomial& operator*=(const CoefficientType& rhs) {
+        coefficient_ *= rhs;
+        if (coefficient_ == 0) { clear_exponents(); }
+        return *this;
+    }
+    friend PackedMonomial operator*(PackedMonomial lhs, const CoefficientType& rhs) { return lhs *= rhs; }
+    friend PackedMonomial operator*(const CoefficientType& lhs, PackedMonomial rhs) { return rhs *= lhs; }
+
+    PackedMonomial& operator/=(const PackedMonomial& rhs) {
+        assert(rhs.coefficient_ != 0);
+        assert(is_divisible_on(rhs) && "Variable power must be non-negative");
+        coefficient_ /= rhs.coefficient_;
+        for (size_t w = 0; w < kWords; ++w) { words_[w] -= rhs.words_[w]; }
+        return *this;
+    }
+    friend PackedMonomial operator/(PackedMonomial lhs, const PackedMonomial& rhs) { return lhs /= rhs; }
+
+    PackedMonomial& operator/=(const CoefficientType& rhs) {
+        assert(rhs != 0 && "Division by zero!");
+        coefficient_ /= rhs;
+        return *this;
+    }
+    friend PackedMonomial operator/(PackedMonomial lhs, const CoefficientType& rhs) { return lhs /= rhs; }
+
+    PackedMonomial operator-() const {
+        PackedMonomial res = *this;
+        res.coefficient_ = -coefficient_;
+        return res;
+    }
+
+    //Fields of (lhs | guards) - rhs keep their guard bit exactly when lhs field isn't less than rhs field
+    bool is_divisible_on(const PackedMonomial& rhs) const {
+        if (rhs.coefficient_ == 0) { return false; }
+        if (coefficient_ == 0) { return true; }
+        for (size_t w = 0; w < kWords; ++w) {
+            uint64_t guards = get_guards(w);
+            if ((((words_[w] | guards) - rhs.words_[w]) & guards) != guards) { return false; }
+        }
+        return true;
+    }
+
+    //Whether product with rhs would have an exponent or degree that doesn't fit
+    bool is_product_overflowing(const PackedMonomial& rhs) const {
+        for (size_t w = 0; w < kWords; ++w) {
+            if ((words_[w] + rhs.words_[w]) & get_guards(w)) { return true; }
+        }
+        return false;
+    }
+
+    //Comparisons for orders matching the layout: words are compared as unsigned integers, degree goes first.
+    //Grevlex layout starts with the last variable, where greater exponent means smaller monomial,
+    //so exponent lanes are inverted before comparison.
+    bool is_less(const PackedMonomial& rhs, MonomialOrders::Grlex) const
+        requires(kLayout == PackedLayout::Grlex)
+    {
+        return words_ < rhs.words_;
+    }
+
+    bool is_less(const PackedMonomial& rhs, MonomialOrders::Lex) const
+        requires(kLayout == PackedLayout::Grlex)
+    {
+        for (size_t w = 0; w < kWords; ++w) {
+            uint64_t lhs_lanes = words_[w] & get_lanes(w), rhs_lanes = rhs.words_[w] & get_lanes(w);
+            if (lhs_lanes != rhs_lanes) { return lhs_lanes < rhs_lanes; }
+        }
+        return false;
+    }
+
+    bool is_less(const PackedMonomial& rhs, MonomialOrders::Grevlex) const
+        requires(kLayout == PackedLayout::Grevlex)
+    {
+        for (size_t w = 0; w < kWords; ++w) {
+            if (words_[w] != rhs.words_[w]) { return (words_[w] ^ get_lanes(w)) < (rhs.words_[w] ^ get_lanes(w)); }
+        }
+        return false;
+    }
+
+    bool is_zero() const { return coefficient_ == 0; }
+
+    CoefficientType get_coefficient() const { return coefficient_; }
+    void increase_coefficient(const CoefficientType& offset) {
+        coefficient_ += offset;
+        if (is_zero()) { clear_exponents(); }
+    }
+
+    DegreeType get_degree() const { return words_[0] >> kDegreeShift; }
+
+    DegreeType get_exponent(size_t index) const {
+        assert(index < kVariables);
+        size_t lane = get_lane(index);
+        return words_[lane / kLanesPerWord] >> get_shift(lane) & kLaneMask;
+    }
+
+    Proxy<VariableIterator> get_variables_ascending_order() const {
+        return Proxy(VariableIterator(this, 0, false), VariableIterator(this, kVariables, false));
+    }
+
+    Proxy<VariableIterator> get_variables_descending_order() const {
+        return Proxy(VariableIterator(this, 0, true), VariableIterator(this, kVariables, true));
+    }
+
+    static PackedMonomial ZeroMonomial() { return PackedMonomial(); }
+
+    bool operator==(const PackedMonomial& rhs) const {
+        return coefficient_ == rhs.coefficient_ && words_ == rhs.words_;
+    }
+    friend bool operator!=(const PackedMonomial& lhs, const PackedMonomial& rhs) { return !(lhs == rhs); }
+
+    friend PackedMonomial gcd(const PackedMonomial& m1, const PackedMonomial& m2) {
+        if (m1.is_zero() || m2.is_zero()) { return m1.is_zero() ? m2 : m1; }
+        return combine_lanes(m1, m2, false);
+    }
+
+    friend PackedMonomial lcm(const PackedMonomial& m1, const PackedMonomial& m2) {
+        if (m1.is_zero() || m2.is_zero()) { return m1.is_zero() ? m2 : m1; }
+        return combine_lanes(m1, m2, true);
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const PackedMonomial& monomial) {
+        if (monomial.is_zero()) { return os << "0"; }
+        CoefficientType coef = monomial.coefficient_;
+        if (coef < 0) {
+            os << "-";
+            coef *= -1;
+        }
+        if (coef != 1 || monomial.get_degree() == 0) { os << coef; }
+        for (const auto& [var, deg] : monomial.get_variables_descending_order()) {
+            os << var;
+            if (deg > 1) { os << "^" << deg; }
+        }
+        return os;
+    }
+
+private:
+    static size_t get_index(const Var& var) {
+        assert(var.get_letter() == kLetter && var.get_number() >= 0 && size_t(var.get_number()) < kVariables &&
+               "Variable is out of the packed monomial");
+        return var.get_number();
+    }
+
+    //Lanes are numbered from the highest one of the first word, the degree field takes first of them
+    static size_t get_lane(size_t index) {
+        return kDegreeLanes + (kLayout == PackedLayout::Grlex ? index : kVariables - 1 - index);
+    }
+
+    static size_t get_shift(size_t lane) { return (kLanesPerWord - 1 - lane % kLanesPerWord) * kLaneBits; }
+
+    void set_exponent(size_t index, DegreeType exponent) {
+        assert(0 <= exponent && exponent <= kMaxExponent && "Exponent overflow");
+        size_t lane = get_lane(index);
+        uint64_t& word = words_[lane / kLanesPerWord];
+        words_[0] -= uint64_t(get_exponent(index)) << kDegreeShift;
+        word = (word & ~(kLaneMask << get_shift(lane))) | (uint64_t(exponent) << get_shift(lane));
+        words_[0] += uint64_t(exponent) << kDegreeShift;
+        assert(get_degree() <= kMaxDegree && "Degree overflow");
+    }
+
+    void clear_exponents() { words_ = {}; }
+
+    bool has_overflow() const {
+        for (size_t w = 0; w < kWords; ++w) {
+            if (words_[w] & get_guards(w)) { return true; }
+        }
+        return false;
+    }
+
+    //Lane-wise maximum or minimum of exponents with coefficient 1, degree is summed up afterwards
+    static PackedMonomial combine_lanes(const PackedMonomial& m1, const PackedMonomial& m2, bool maximum) {
+        PackedMonomial res;
+        res.coefficient_ = 1;
+        uint64_t degree = 0;
+        for (size_t w = 0; w < kWords; ++w) {
+            uint64_t a = m1.words_[w], b = m2.words_[w];
+            //All ones in lanes where a >= b
+            uint64_t greater_or_equal = ((((a | kLaneGuards) - b) & kLaneGuards) >> (kLaneBits - 1)) * kLaneMask;
+            greater_or_equal &= get_lanes(w);
+            uint64_t word = maximum ? (a & greater_or_equal) | (b & ~greater_or_equal)
+                                    : (b & greater_or_equal) | (a & ~greater_or_equal);
+            res.words_[w] = word & get_lanes(w);
+            for (size_t i = 0; i < kLanesPerWord; ++i) { degree += res.words_[w] >> (i * kLaneBits) & kLaneMask; }
+        }
+        res.words_[0] |= degree << kDegreeShift;
+        return res;
+    }
+
+    CoefficientType coefficient_ = 0;
+    Words words_{};
+};
+
+template<typename A, size_t B, typename C, PackedLayout D, char E>
+struct is_monomial<PackedMonomial<A, B, C, D, E>> : std::true_type {};
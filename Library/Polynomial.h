@@ -17,32 +17,53 @@ class Polynomial {
     static_assert(is_monomial<Monom>::value);
     using CoefficientType = typename Monom::CoefficientType_;
     using DegreeType = typename Monom::DegreeType_;
+    using MonomStore = std::pmr::set<Monom, MonomialOrder>;
 
 public:
+    using Monom_ = Monom;
+    using MonomialOrder_ = MonomialOrder;
+
     Polynomial() = default;
 
+    //Copies take memory from the current resource, moves keep the resource of the source
+    Polynomial(const Polynomial& rhs) : Polynomial(rhs, memory::get_current_resource()) {}
+
+    Polynomial(const Polynomial& rhs, std::pmr::memory_resource* resource)
+        : monom_store_(rhs.monom_store_, resource) {}
+
+    Polynomial(Polynomial&& rhs) = default;
+    Polynomial& operator=(const Polynomial& rhs) = default;
+    Polynomial& operator=(Polynomial&& rhs) = default;
+
     Polynomial(const Monom& m) {
         if (!m.is_zero()) { monom_store_.insert(m); }
     }
 
-    Polynomial(const Monom&& m) {
+    Polynomial(Monom&& m) {
         if (!m.is_zero()) { monom_store_.insert(std::move(m)); }
     }
 
-    Polynomial(std::string s) {
-        s.erase(remove_if(s.begin(), s.end(), [](char c) { return std::isspace(c); }), s.end());
-        for (size_t l = 0, r, dep; l < s.size();) {
-            r = l, dep = s[l] == '{';
-            while (r + 1 < s.size() && (dep > 0 || (dep == 0 && s[r + 1] != '-' && s[r + 1] != '+'))) {
-                ++r;
-                assert(!(dep == 0 && s[r] == '}') && "Bad parenthesis {} at input string");
-                dep += s[r] == '{';
-                dep -= s[r] == '}';
-            }
-            add(Monom(s.substr(l, r - l + 1)));
-            l = r + 1;
-        }
-        remove_zero_monomials();
+    Polynomial(const std::string& s) {
+        size_t pos = 0;
+        [[maybe_unused]] const char* error = parse(s, &pos, this);
+        assert(error == nullptr && "Bad polynomial");
+        assert(pos == s.size() && "Unexpected character in polynomial");
+    }
+
+    //Reads sum of monomials starting at *pos into res and stops at the first character that can't continue it,
+    //for example at the end of line. Returns nullptr or error message as MonomialParser does
+    static const char* parse(std::string_view s, size_t* pos, Polynomial* res) {
+        res->monom_store_.clear();
+        num_reader::skip_spaces(s, pos);
+        if (*pos == s.size() || s[*pos] == '\n') { return nullptr; }
+        Monom m;
+        do {
+            if (const char* error = Monom::parse(s, pos, &m)) { return error; }
+            res->add(std::move(m));
+            num_reader::skip_spaces(s, pos);
+        } while (*pos < s.size() && (s[*pos] == '+' || s[*pos] == '-'));
+        res->remove_zero_monomials();
+        return nullptr;
     }
 
     Polynomial& operator+=(const Polynomial& rhs) {
@@ -50,10 +71,13 @@ public:
         remove_zero_monomials();
         return *this;
     }
-    friend Polynomial operator+(const Polynomial& lhs, const Polynomial& rhs) {
-        Polynomial res = lhs;
-        res += rhs;
-        return res;
+    Polynomial& operator+=(const Monom& rhs) {
+        add(rhs);
+        return *this;
+    }
+    friend Polynomial operator+(Polynomial lhs, const Polynomial& rhs) {
+        lhs += rhs;
+        return lhs;
     }
 
     Polynomial& operator-=(const Polynomial& rhs) {
@@ -61,10 +85,13 @@ public:
         remove_zero_monomials();
         return *this;
     }
-    friend Polynomial operator-(const Polynomial& lhs, const Polynomial& rhs) {
-        Polynomial res = lhs;
-        res -= rhs;
-        return res;
+    Polynomial& operator-=(const Monom& rhs) {
+        add(-rhs);
+        return *this;
+    }
+    friend Polynomial operator-(Polynomial lhs, const Polynomial& rhs) {
+        lhs -= rhs;
+        return lhs;
     }
     Polynomial operator-() const { return *this * CoefficientType(-1); }
 
@@ -72,39 +99,34 @@ public:
         if (rhs == 0) {
             monom_store_.clear();
         } else {
-            std::set<Monom, MonomialOrder> new_store;
-            for (const auto& monomial : monom_store_) { new_store.insert(monomial * rhs); }
-            monom_store_ = std::move(new_store);
+            transform_monomials([&rhs](Monom& monomial) { monomial *= rhs; });
         }
         return *this;
     }
-    friend Polynomial operator*(const Polynomial& lhs, const CoefficientType& rhs) {
-        Polynomial res = lhs;
-        res *= rhs;
-        return res;
+    friend Polynomial operator*(Polynomial lhs, const CoefficientType& rhs) {
+        lhs *= rhs;
+        return lhs;
     }
-    friend Polynomial operator*(const CoefficientType& lhs, const Polynomial& rhs) {
-        Polynomial res = rhs;
-        res *= lhs;
-        return res;
+    friend Polynomial operator*(const CoefficientType& lhs, Polynomial rhs) {
+        rhs *= lhs;
+        return rhs;
     }
 
     Polynomial& operator*=(const Monom& rhs) {
-        std::set<Monom, MonomialOrder> new_store;
-        for (const auto& monom1 : monom_store_) { new_store.insert(monom1 * rhs); }
-        monom_store_ = std::move(new_store);
-        remove_zero_monomials();
+        if (rhs.is_zero()) {
+            monom_store_.clear();
+        } else {
+            transform_monomials([&rhs](Monom& monomial) { monomial *= rhs; });
+        }
         return *this;
     }
-    friend Polynomial operator*(const Polynomial& lhs, const Monom& rhs) {
-        Polynomial res = lhs;
-        res *= rhs;
-        return res;
+    friend Polynomial operator*(Polynomial lhs, const Monom& rhs) {
+        lhs *= rhs;
+        return lhs;
     }
-    friend Polynomial operator*(const Monom& lhs, const Polynomial& rhs) {
-        Polynomial res = rhs;
-        res *= lhs;
-        return res;
+    friend Polynomial operator*(const Monom& lhs, Polynomial rhs) {
+        rhs *= lhs;
+        return rhs;
     }
 
     Polynomial& operator*=(const Polynomial& rhs) {
@@ -114,29 +136,57 @@ public:
         }
         return *this = std::move(res);
     }
-    friend Polynomial operator*(const Polynomial& lhs, const Polynomial& rhs) {
-        Polynomial res = lhs;
-        res *= rhs;
-        return res;
+    friend Polynomial operator*(Polynomial lhs, const Polynomial& rhs) {
+        lhs *= rhs;
+        return lhs;
     }
 
-    Polynomial& operator/=(const CoefficientType& rhs) { return (*this) *= invert(rhs); }
-    friend Polynomial operator/(const Polynomial& lhs, const CoefficientType& rhs) {
-        Polynomial res = lhs;
-        res /= rhs;
-        return res;
+    //Over the integers division must be exact for every coefficient
+    Polynomial& operator/=(const CoefficientType& rhs) {
+        if constexpr (is_integer<CoefficientType>::value) {
+            transform_monomials([&rhs](Monom& monomial) { monomial /= rhs; });
+            return *this;
+        } else {
+            return (*this) *= invert(rhs);
+        }
+    }
+    friend Polynomial operator/(Polynomial lhs, const CoefficientType& rhs) {
+        lhs /= rhs;
+        return lhs;
     }
 
     Polynomial& operator/=(const Monom& rhs) {
-        std::set<Monom, MonomialOrder> new_store;
-        for (const auto& monom : monom_store_) { new_store.insert(monom / rhs); }
-        monom_store_ = std::move(new_store);
+        transform_monomials([&rhs](Monom& monomial) { monomial /= rhs; });
         return *this;
     }
-    friend Polynomial operator/(const Polynomial& lhs, const Monom& rhs) {
-        Polynomial res = lhs;
-        res /= rhs;
-        return res;
+    friend Polynomial operator/(Polynomial lhs, const Monom& rhs) {
+        lhs /= rhs;
+        return lhs;
+    }
+
+    //*this -= m * q without materializing the product: terms of q are multiplied into one scratch monomial,
+    //matching terms of *this are updated in place, and only terms missing from *this take new memory
+    void subtract_multiple(const Monom& m, const Polynomial& q) {
+        if (m.is_zero()) { return; }
+        if (this == &q) {
+            *this -= m * q;
+            return;
+        }
+        Monom product;
+        for (const auto& term : q.monom_store_) {
+            product = term;
+            product *= m;
+            auto it = monom_store_.find(product);
+            if (it == monom_store_.end()) {
+                product *= CoefficientType(-1);
+                monom_store_.insert(std::move(product));
+                continue;
+            }
+            auto next = std::next(it);
+            auto node = monom_store_.extract(it);
+            node.value().increase_coefficient(-product.get_coefficient());
+            if (!node.value().is_zero()) { monom_store_.insert(next, std::move(node)); }
+        }
     }
 
     bool operator==(const Polynomial& rhs) const { return monom_store_ == rhs.monom_store_; }
@@ -152,12 +202,59 @@ public:
 
     bool is_zero() const { return monom_store_.empty(); }
 
+    size_t size() const { return monom_store_.size(); }
+
+    bool is_homogeneous() const {
+        return std::all_of(monom_store_.begin(), monom_store_.end(), [this](const Monom& monomial) {
+            return monomial.get_degree() == monom_store_.begin()->get_degree();
+        });
+    }
+
     DegreeType get_degree() const {
         DegreeType ans = 0;
         for (const auto& monomial : monom_store_) { ans = std::max(ans, monomial.get_degree()); }
         return ans;
     }
 
+    //Multiplies every term by the power of h, that completes it to the degree of the polynomial.
+    //h mustn't occur in the polynomial.
+    Polynomial homogenize(const typename Monom::Variable_& h) const {
+        DegreeType degree = get_degree();
+        Polynomial res;
+        for (const Monom& m : monom_store_) {
+            res += m * Monom(CoefficientType(1), h, degree - m.get_degree());
+        }
+        return res;
+    }
+
+    //Substitutes h = 1
+    Polynomial dehomogenize(const typename Monom::Variable_& h) const {
+        Polynomial res;
+        std::vector<std::pair<typename Monom::Variable_, DegreeType>> variables;
+        for (const Monom& m : monom_store_) {
+            variables.clear();
+            for (const auto& [var, deg] : m.get_variables_ascending_order()) {
+                if (var != h) { variables.emplace_back(var, deg); }
+            }
+            res += Monom(m.get_coefficient(), variables);
+        }
+        return res;
+    }
+
+    Proxy<typename MonomStore::const_iterator> get_monomials_ascending_order() const {
+        return Proxy(monom_store_.begin(), monom_store_.end());
+    }
+
+    Proxy<typename MonomStore::const_reverse_iterator> get_monomials_descending_order() const {
+        return Proxy(monom_store_.rbegin(), monom_store_.rend());
+    }
+
+    //Appends nonzero term greater than all present ones in constant time, e.g. when terms come already sorted
+    void append_highest_monomial(Monom&& m) {
+        assert(!m.is_zero() && (is_zero() || MonomialOrder()(*monom_store_.rbegin(), m)));
+        monom_store_.emplace_hint(monom_store_.end(), std::move(m));
+    }
+
     Monom get_highest_monomial() const { return is_zero() ? Monom::ZeroMonomial() : *monom_store_.rbegin(); }
 
     Monom get_highest_monomial_divisible_by(const Monom& m) const {
@@ -168,22 +265,75 @@ public:
     }
 
     bool do_one_elementary_reduction_over(Polynomial& p) const {
-        Monom monom = p.get_highest_monomial_divisible_by(get_highest_monomial());
-        if (monom.is_zero()) { return false; }
-        p -= monom / get_highest_monomial() * (*this);
-        return true;
+        if (is_zero()) { return false; }
+        return cancel_term_of(p, p.get_highest_monomial_divisible_by(*monom_store_.rbegin()));
+    }
+
+    //Cancels only the leading term of p, its tail is left as is
+    bool do_one_top_reduction_over(Polynomial& p) const {
+        if (is_zero() || p.is_zero() || !p.monom_store_.rbegin()->is_divisible_on(*monom_store_.rbegin())) {
+            return false;
+        }
+        return cancel_term_of(p, *p.monom_store_.rbegin());
     }
 
+    //Cancels the term of p with monomial m, false if p has no such term or it isn't divisible by the leading one
+    bool do_one_elementary_reduction_at(Polynomial& p, const Monom& m) const {
+        if (is_zero()) { return false; }
+        auto it = p.monom_store_.find(m);
+        if (it == p.monom_store_.end() || !it->is_divisible_on(*monom_store_.rbegin())) { return false; }
+        return cancel_term_of(p, *it);
+    }
+
+    //Makes leading coefficient 1, or over the integers divides by the content and makes it positive
     void normalize() {
-        if (!is_zero()) { (*this) /= get_highest_monomial().get_coefficient(); }
+        if (is_zero()) { return; }
+        if constexpr (is_integer<CoefficientType>::value) {
+            CoefficientType content = get_content();
+            if (monom_store_.rbegin()->get_coefficient() < 0) { content = -content; }
+            if (content != 1) { (*this) /= content; }
+        } else {
+            (*this) /= monom_store_.rbegin()->get_coefficient();
+        }
+    }
+
+    bool is_normalized() const {
+        if (is_zero()) { return true; }
+        if constexpr (is_integer<CoefficientType>::value) {
+            return monom_store_.rbegin()->get_coefficient() > 0 && get_content() == 1;
+        } else {
+            return monom_store_.rbegin()->get_coefficient() == 1;
+        }
+    }
+
+    //Gcd of all coefficients, usually a few leading terms already bring it down to 1
+    CoefficientType get_content() const
+        requires is_integer<CoefficientType>::value
+    {
+        CoefficientType content = 0;
+        for (auto it = monom_store_.rbegin(); it != monom_store_.rend() && content != 1; ++it) {
+            content = gcd(content, it->get_coefficient());
+        }
+        return content;
     }
 
     friend Polynomial get_S_polynomial(const Polynomial& p1, const Polynomial& p2) {
         assert(!p1.is_zero() && !p2.is_zero());
         auto lc = lcm(p1.get_highest_monomial(), p2.get_highest_monomial());
-        auto m1 = lc / p1.get_highest_monomial();
-        auto m2 = lc / p2.get_highest_monomial();
-        return p1 * m1 - p2 * m2;
+        Monom m1, m2;
+        if constexpr (is_integer<CoefficientType>::value) {
+            //Cofactors b / d and a / d for leading coefficients a and b, d = gcd(a, b)
+            CoefficientType a = p1.get_highest_monomial().get_coefficient();
+            CoefficientType b = p2.get_highest_monomial().get_coefficient(), d = gcd(a, b);
+            m1 = lc / (p1.get_highest_monomial() / a) * (b / d);
+            m2 = lc / (p2.get_highest_monomial() / b) * (a / d);
+        } else {
+            m1 = lc / p1.get_highest_monomial();
+            m2 = lc / p2.get_highest_monomial();
+        }
+        Polynomial res = p1 * m1;
+        res.subtract_multiple(m2, p2);
+        return res;
     }
 
     friend std::ostream& operator<<(std::ostream& os, const Polynomial& polynomial) {
@@ -206,16 +356,49 @@ public:
     }
 
 private:
-    void add(const Monom& m) {
-        if (!monom_store_.count(m)) {
-            if (!m.is_zero()) monom_store_.insert(m);
+    //Cancels term b * t of p, which is divisible by the leading monomial.
+    //Over the integers the term is cancelled without division: p is multiplied by a / d first,
+    //where a is the leading coefficient and d = gcd(a, b), then b / d * t / lm * (*this) is subtracted
+    bool cancel_term_of(Polynomial& p, Monom quotient) const {
+        if (quotient.is_zero()) { return false; }
+        const Monom& leading = *monom_store_.rbegin();
+        if constexpr (is_integer<CoefficientType>::value) {
+            CoefficientType a = leading.get_coefficient(), d = gcd(a, quotient.get_coefficient());
+            quotient /= leading / a;
+            quotient /= d;
+            if (a != d) { p *= a / d; }
+        } else {
+            quotient /= leading;
+        }
+        p.subtract_multiple(quotient, *this);
+        return true;
+    }
+
+    template<typename M>
+    void add(M&& m) {
+        auto it = monom_store_.find(m);
+        if (it == monom_store_.end()) {
+            if (!m.is_zero()) monom_store_.insert(std::forward<M>(m));
         } else {
-            auto nh = monom_store_.extract(m);
+            auto next = std::next(it);
+            auto nh = monom_store_.extract(it);
             nh.value().increase_coefficient(m.get_coefficient());
-            if (!nh.value().is_zero()) monom_store_.insert(std::move(nh));
+            if (!nh.value().is_zero()) monom_store_.insert(next, std::move(nh));
         }
     }
 
+    //Transformation must preserve the order of terms, so nodes are relinked instead of being reallocated
+    template<typename Transformation>
+    void transform_monomials(Transformation&& transformation) {
+        MonomStore new_store(monom_store_.get_allocator());
+        while (!monom_store_.empty()) {
+            auto node = monom_store_.extract(monom_store_.begin());
+            transformation(node.value());
+            new_store.insert(new_store.end(), std::move(node));
+        }
+        monom_store_ = std::move(new_store);
+    }
+
     void remove_zero_monomials() {
         for (auto it = monom_store_.begin(); it != monom_store_.end();) {
             if (it->get_coefficient() == 0) {
@@ -226,5 +409,5 @@ private:
         }
     }
 
-    std::set<Monom, MonomialOrder> monom_store_;
+    MonomStore monom_store_{memory::get_current_resource()};
 };
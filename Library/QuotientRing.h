@@ -0,0 +1,252 @@
+#pragma once
+#include "Ideal.h"
+#include "MonomialIdeal.h"
+#include <algorithm>
+#include <numeric>
+#include <set>
+
+//Finite-dimensional quotient ring K[x_1, ..., x_n] / I of a zero-dimensional ideal I.
+//Elements are dense coefficient vectors over standard monomials (monomials not divisible by any leading monomial
+//of the reduced Groebner basis). Multiplication by each variable is precomputed as a sparse matrix, so arithmetic
+//never touches polynomials or reduction again.
+template<typename Polynom>
+class QuotientRing {
+    using Monom = typename Polynom::Monom_;
+    using CoefficientType = typename Monom::CoefficientType_;
+    using MonomialOrder = typename Polynom::MonomialOrder_;
+    using Var = typename Monom::Variable_;
+    static_assert(!is_integer<CoefficientType>::value, "Quotient rings are built over fields");
+
+public:
+    using Element = std::vector<CoefficientType>;
+    //Column j holds coordinates of x * b_j, where b_j is j-th standard monomial
+    using SparseColumn = std::vector<std::pair<size_t, CoefficientType>>;
+    using MultiplicationMatrix = std::vector<SparseColumn>;
+
+    //For a positive-dimensional ideal the ring is left empty and get_error() tells why
+    explicit QuotientRing(Ideal<Polynom> ideal) {
+        ideal.make_reduced_groebner_basis();
+        reducer_ = ideal.get_reducer();
+        collect_variables();
+        if (!enumerate_standard_monomials(get_leading_ideal())) {
+            error_ = "Quotient ring of a positive-dimensional ideal is infinite-dimensional";
+            variables_.clear();
+            return;
+        }
+        build_multiplication_matrices();
+    }
+
+    const char* get_error() const { return error_; }
+
+    size_t dimension() const { return standard_monomials_.size(); }
+
+    const std::vector<Monom>& get_standard_monomials() const { return standard_monomials_; }
+
+    const std::vector<Var>& get_variables() const { return variables_; }
+
+    const std::vector<Polynom>& get_basis() const { return reducer_.get_basis(); }
+
+    const MultiplicationMatrix& get_multiplication_matrix(size_t variable_index) const {
+        return multiplication_matrices_[variable_index];
+    }
+
+    //Returns index of standard monomial equal to m (up to coefficient) or dimension() if m is not standard
+    size_t find_standard_monomial(const Monom& m) const {
+        auto it = standard_monomial_index_.find(m);
+        return it == standard_monomial_index_.end() ? dimension() : it->second;
+    }
+
+    Element zero() const { return Element(dimension(), CoefficientType(0)); }
+
+    Element one() const {
+        Element res = zero();
+        if (dimension()) { res[0] = 1; }
+        return res;
+    }
+
+    Element to_element(const Polynom& p) const {
+        Element res = zero();
+        Polynom normal_form = reducer_.normal_form(p);
+        for (const Monom& m : normal_form.get_monomials_ascending_order()) {
+            res[find_standard_monomial(m)] += m.get_coefficient();
+        }
+        return res;
+    }
+
+    Polynom to_polynomial(const Element& element) const {
+        Polynom res;
+        for (size_t i = 0; i < dimension(); ++i) {
+            if (element[i] != 0) { res += standard_monomials_[i] * element[i]; }
+        }
+        return res;
+    }
+
+    Element add(Element lhs, const Element& rhs) const {
+        for (size_t i = 0; i < dimension(); ++i) { lhs[i] += rhs[i]; }
+        return lhs;
+    }
+
+    Element subtract(Element lhs, const Element& rhs) const {
+        for (size_t i = 0; i < dimension(); ++i) { lhs[i] -= rhs[i]; }
+        return lhs;
+    }
+
+    Element multiply_by_variable(const Element& element, size_t variable_index) const {
+        return apply(multiplication_matrices_[variable_index], element);
+    }
+
+    //Computes sum_j rhs_j * (b_j * lhs), where b_j * lhs is obtained from the product for the parent of b_j
+    //by one more sparse matrix-vector multiplication. Products are kept only while children of their standard
+    //monomials remain to be visited, see build_traversal_order
+    Element multiply(const Element& lhs, const Element& rhs) const {
+        Element res = zero();
+        std::vector<Element> pending;
+        for (size_t j : traversal_order_) {
+            const auto& [parent, variable_index] = parents_[j];
+            bool is_leaf = last_child_[j] == dimension();
+            Element shifted;
+            if (rhs[j] != 0 || !is_leaf) {
+                shifted = parent == dimension() ? lhs : multiply_by_variable(pending.back(), variable_index);
+            }
+            if (parent != dimension() && last_child_[parent] == j) { pending.pop_back(); }
+            if (rhs[j] != 0) {
+                for (size_t i = 0; i < dimension(); ++i) { res[i] += rhs[j] * shifted[i]; }
+            }
+            if (!is_leaf) { pending.push_back(std::move(shifted)); }
+        }
+        return res;
+    }
+
+    Element pow(Element element, uint64_t power) const {
+        Element res = one();
+        for (; power; power >>= 1) {
+            if (power & 1) { res = multiply(res, element); }
+            element = multiply(element, element);
+        }
+        return res;
+    }
+
+private:
+    Element apply(const MultiplicationMatrix& matrix, const Element& element) const {
+        Element res = zero();
+        for (size_t j = 0; j < dimension(); ++j) {
+            if (element[j] == 0) { continue; }
+            for (const auto& [i, coefficient] : matrix[j]) { res[i] += coefficient * element[j]; }
+        }
+        return res;
+    }
+
+    static Monom variable_monomial(const Var& var) { return Monom(CoefficientType(1), var, 1); }
+
+    void collect_variables() {
+        std::set<Var> variables;
+        for (const Polynom& p : get_basis()) {
+            for (const Monom& m : p.get_monomials_ascending_order()) {
+                for (const auto& [var, deg] : m.get_variables_ascending_order()) { variables.insert(var); }
+            }
+        }
+        variables_.assign(variables.begin(), variables.end());
+    }
+
+    //Exponents of leading monomials indexed by positions of variables
+    MonomialIdeal get_leading_ideal() const {
+        std::vector<MonomialIdeal::Exponents> exponents;
+        for (const Polynom& p : get_basis()) {
+            MonomialIdeal::Exponents& e = exponents.emplace_back(variables_.size());
+            Monom leading = p.get_highest_monomial();
+            for (const auto& [var, deg] : leading.get_variables_ascending_order()) {
+                e[std::lower_bound(variables_.begin(), variables_.end(), var) - variables_.begin()] = deg;
+            }
+        }
+        return MonomialIdeal(exponents, variables_.size());
+    }
+
+    bool enumerate_standard_monomials(const MonomialIdeal& leading) {
+        std::vector<Monom> found;
+        std::vector<std::pair<size_t, size_t>> found_parents;
+        bool is_finite = leading.for_each_standard_monomial(INT64_MAX, [&](const MonomialIdeal::Exponents&,
+                                                                           size_t parent, size_t v) {
+            found.push_back(parent == SIZE_MAX ? Monom("1") : found[parent] * variable_monomial(variables_[v]));
+            found_parents.push_back({parent, v});
+        });
+        if (!is_finite) { return false; }
+        //Standard monomials are stored in increasing order, parents are remapped to these positions
+        std::vector<size_t> sorted(found.size());
+        std::iota(sorted.begin(), sorted.end(), 0);
+        MonomialOrder order;
+        std::sort(sorted.begin(), sorted.end(), [&](size_t i, size_t j) { return order(found[i], found[j]); });
+        std::vector<size_t> position(found.size());
+        for (size_t i = 0; i < sorted.size(); ++i) { position[sorted[i]] = i; }
+        for (size_t i = 0; i < sorted.size(); ++i) {
+            const auto& [parent, variable_index] = found_parents[sorted[i]];
+            standard_monomials_.push_back(found[sorted[i]]);
+            standard_monomial_index_[found[sorted[i]]] = i;
+            parents_.push_back({parent == SIZE_MAX ? found.size() : position[parent], variable_index});
+        }
+        std::vector<size_t> breadth_first_order;
+        for (size_t k = 0; k < found.size(); ++k) { breadth_first_order.push_back(position[k]); }
+        build_traversal_order(breadth_first_order);
+        return true;
+    }
+
+    //Depth-first order, in which the child with the largest subtree is visited last. The product for a monomial
+    //is dropped once its last child is built, and every other child has at most half of the monomials in its
+    //subtree, so multiply keeps at most log2(dimension()) + 1 products at once
+    void build_traversal_order(const std::vector<size_t>& breadth_first_order) {
+        std::vector<size_t> subtree_size(dimension(), 1);
+        std::vector<std::vector<size_t>> children(dimension());
+        for (auto it = breadth_first_order.rbegin(); it != breadth_first_order.rend(); ++it) {
+            size_t parent = parents_[*it].first;
+            if (parent == dimension()) { continue; }
+            subtree_size[parent] += subtree_size[*it];
+            children[parent].push_back(*it);
+        }
+        last_child_.assign(dimension(), dimension());
+        std::vector<size_t> stack;
+        if (!breadth_first_order.empty()) { stack.push_back(breadth_first_order[0]); }
+        while (!stack.empty()) {
+            size_t j = stack.back();
+            stack.pop_back();
+            traversal_order_.push_back(j);
+            if (children[j].empty()) { continue; }
+            auto largest = std::max_element(children[j].begin(), children[j].end(),
+                                            [&](size_t c1, size_t c2) { return subtree_size[c1] < subtree_size[c2]; });
+            std::iter_swap(largest, children[j].begin());
+            last_child_[j] = children[j][0];
+            stack.insert(stack.end(), children[j].begin(), children[j].end());
+        }
+    }
+
+    void build_multiplication_matrices() {
+        NormalFormCache<Polynom> cache;
+        multiplication_matrices_.assign(variables_.size(), MultiplicationMatrix(dimension()));
+        for (size_t v = 0; v < variables_.size(); ++v) {
+            for (size_t j = 0; j < dimension(); ++j) {
+                Monom product = standard_monomials_[j] * variable_monomial(variables_[v]);
+                size_t index = find_standard_monomial(product);
+                if (index != dimension()) {
+                    multiplication_matrices_[v][j].push_back({index, CoefficientType(1)});
+                    continue;
+                }
+                Polynom normal_form = cache.normal_form(Polynom(product), reducer_);
+                for (const Monom& m : normal_form.get_monomials_ascending_order()) {
+                    multiplication_matrices_[v][j].push_back({find_standard_monomial(m), m.get_coefficient()});
+                }
+            }
+        }
+    }
+
+    Reducer<Polynom> reducer_;
+    std::vector<Var> variables_;
+    std::vector<Monom> standard_monomials_;
+    std::map<Monom, size_t, MonomialOrder> standard_monomial_index_;
+    //For each standard monomial: index of standard monomial and variable index, such that their product gives it.
+    //For the unit monomial parent index is dimension()
+    std::vector<std::pair<size_t, size_t>> parents_;
+    //Positions of standard monomials in order of depth-first search, every parent precedes its children
+    std::vector<size_t> traversal_order_;
+    //Child visited last by the traversal for each standard monomial, dimension() for monomials without children
+    std::vector<size_t> last_child_;
+    std::vector<MultiplicationMatrix> multiplication_matrices_;
+    const char* error_ = nullptr;
+};
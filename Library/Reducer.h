@@ -0,0 +1,85 @@
+#pragma once
+#include "Polynomial.h"
+#include <algorithm>
+#include <vector>
+
+//Read-only index over leading monomials of a fixed set of polynomials.
+//Computes normal forms without modifying the indexed polynomials, so one instance can be shared between threads.
+template<typename Polynom>
+class Reducer {
+    using Monom = typename Polynom::Monom_;
+    using DegreeType = typename Monom::DegreeType_;
+
+    struct Entry {
+        Monom leading_monomial;
+        DegreeType degree;
+        size_t index;
+    };
+
+public:
+    Reducer() = default;
+
+    explicit Reducer(const std::vector<Polynom>& basis) : basis_(basis) {
+        for (size_t i = 0; i < basis_.size(); ++i) {
+            if (basis_[i].is_zero()) { continue; }
+            Monom leading = basis_[i].get_highest_monomial();
+            DegreeType degree = leading.get_degree();
+            entries_.push_back({std::move(leading), degree, i});
+        }
+        std::stable_sort(entries_.begin(), entries_.end(),
+                         [](const Entry& e1, const Entry& e2) { return e1.degree < e2.degree; });
+    }
+
+    //Returns polynomial whose leading monomial divides m, or nullptr if there is no such polynomial
+    const Polynom* find_reducer(const Monom& m) const {
+        if (m.is_zero()) { return nullptr; }
+        DegreeType degree = m.get_degree();
+        for (const Entry& entry : entries_) {
+            if (entry.degree > degree) { break; }
+            if (m.is_divisible_on(entry.leading_monomial)) { return &basis_[entry.index]; }
+        }
+        return nullptr;
+    }
+
+    bool is_reducible(const Monom& m) const { return find_reducer(m) != nullptr; }
+
+    //Fully reduces p: no monomial of the result is divisible by a leading monomial of the basis.
+    //Over the integers the result is defined up to a rational factor and is normalized like Ideal::reduce does.
+    Polynom normal_form(Polynom p) const {
+        if constexpr (is_integer<typename Monom::CoefficientType_>::value) {
+            //Fraction-free reductions scale the whole polynomial, so irreducible terms are kept in p
+            while (const Polynom* reducer = find_reducer_of_any_term(p)) {
+                [[maybe_unused]] bool was_reduced = reducer->do_one_elementary_reduction_over(p);
+                assert(was_reduced);
+            }
+            p.normalize();
+            return p;
+        }
+        Polynom remainder;
+        while (!p.is_zero()) {
+            Monom leading = p.get_highest_monomial();
+            if (const Polynom* reducer = find_reducer(leading)) {
+                p -= leading / reducer->get_highest_monomial() * (*reducer);
+            } else {
+                p -= leading;
+                remainder += leading;
+            }
+        }
+        return remainder;
+    }
+
+    const std::vector<Polynom>& get_basis() const { return basis_; }
+
+    size_t size() const { return entries_.size(); }
+
+private:
+    const Polynom* find_reducer_of_any_term(const Polynom& p) const {
+        for (const Monom& m : p.get_monomials_descending_order()) {
+            if (const Polynom* reducer = find_reducer(m)) { return reducer; }
+        }
+        return nullptr;
+    }
+
+    std::vector<Polynom> basis_;
+    std::vector<Entry> entries_;
+};
@@ -0,0 +1,448 @@
+#pragma once
+#include "../Parsers/MappedFile.h"
+#include "Ideal.h"
+#include <cstring>
+#include <fstream>
+#include <numeric>
+#include <set>
+
+//Versioned binary format of polynomials and ideals. All fields are in native byte order and aligned to 8 bytes,
+//so a mapped file is read in place without any parsing:
+//  Header
+//  variables_count x VariableEntry in increasing order of variables
+//  polynomials_count + 1 term offsets (uint64_t), terms of i-th polynomial are [offsets[i], offsets[i + 1])
+//  terms_count raw coefficients, padded to 8 bytes
+//  terms_count rows of variables_count exponents (uint32_t), padded to 8 bytes
+//Terms of every polynomial go in increasing monomial order.
+namespace serialization {
+    constexpr char kMagic[4] = {'G', 'B', 'L', 'B'};
+    constexpr uint32_t kVersion = 2;
+    constexpr size_t kAlignment = 8;
+
+    enum class Kind : uint16_t { Polynomial = 1, Ideal = 2, Checkpoint = 3 };
+
+    //Coefficient types may have the same size and layout, so the type is recorded as well
+    enum class CoefficientKind : uint32_t { Other = 0, Fraction = 1, Integer = 2, Mint = 3, RuntimeMint = 4, GF2 = 5 };
+
+    struct Header {
+        char magic[4];
+        uint32_t version;
+        uint16_t kind;
+        uint16_t basis_type;
+        uint32_t coefficient_size;
+        //Modulus of modular fields, including the current one of RuntimeMint, 0 for other coefficients
+        uint64_t coefficient_tag;
+        uint32_t variables_count;
+        uint32_t coefficient_kind;
+        uint64_t polynomials_count;
+        uint64_t terms_count;
+    };
+    static_assert(sizeof(Header) % kAlignment == 0);
+
+    struct VariableEntry {
+        int64_t number;
+        int32_t letter;
+        uint32_t reserved;
+    };
+    static_assert(sizeof(VariableEntry) % kAlignment == 0);
+
+    inline size_t get_padding(size_t bytes) { return (kAlignment - bytes % kAlignment) % kAlignment; }
+
+    template<typename CoefficientType>
+    CoefficientKind get_coefficient_kind() {
+        if constexpr (requires(const CoefficientType& c) { c.get_denominator(); }) {
+            return CoefficientKind::Fraction;
+        } else if constexpr (is_integer<CoefficientType>::value) {
+            return CoefficientKind::Integer;
+        } else if constexpr (is_mint<CoefficientType>::value) {
+            return CoefficientKind::Mint;
+        } else if constexpr (std::is_same_v<CoefficientType, GF2>) {
+            return CoefficientKind::GF2;
+        } else if constexpr (requires { CoefficientType::get_modulus(); }) {
+            return CoefficientKind::RuntimeMint;
+        } else {
+            return CoefficientKind::Other;
+        }
+    }
+
+    template<typename CoefficientType>
+    uint64_t get_coefficient_tag() {
+        if constexpr (requires { CoefficientType::get_modulus(); }) {
+            return static_cast<uint64_t>(CoefficientType::get_modulus());
+        } else {
+            return 0;
+        }
+    }
+
+    //Offsets of sections from the beginning of serialized data. Counts of a corrupted header may overflow them,
+    //then is_valid is false and offsets are meaningless.
+    struct Layout {
+        size_t variables;
+        size_t offsets;
+        size_t coefficients;
+        size_t coefficients_size;
+        size_t exponents;
+        size_t exponents_size;
+        size_t end;
+        bool is_valid = true;
+
+        explicit Layout(const Header& header) {
+            auto add = [this](size_t lhs, size_t rhs) {
+                size_t res;
+                is_valid &= !__builtin_add_overflow(lhs, rhs, &res);
+                return res;
+            };
+            auto multiply = [this](size_t lhs, size_t rhs) {
+                size_t res;
+                is_valid &= !__builtin_mul_overflow(lhs, rhs, &res);
+                return res;
+            };
+            variables = sizeof(Header);
+            offsets = add(variables, multiply(header.variables_count, sizeof(VariableEntry)));
+            coefficients = add(offsets, multiply(add(header.polynomials_count, 1), sizeof(uint64_t)));
+            coefficients_size = multiply(header.terms_count, header.coefficient_size);
+            exponents = add(add(coefficients, coefficients_size), get_padding(coefficients_size));
+            exponents_size = multiply(multiply(header.terms_count, header.variables_count), sizeof(uint32_t));
+            end = add(add(exponents, exponents_size), get_padding(exponents_size));
+        }
+    };
+
+    template<typename Polynom>
+    class Codec {
+        using Monom = typename Polynom::Monom_;
+        using MonomialOrder = typename Polynom::MonomialOrder_;
+        using CoefficientType = typename Monom::CoefficientType_;
+        using DegreeType = typename Monom::DegreeType_;
+        using Var = typename Monom::Variable_;
+        static_assert(std::is_trivially_copyable_v<CoefficientType>, "Coefficients are stored as raw bytes");
+
+    public:
+        static void write(std::ostream& os, std::span<const Polynom> polynomials, Kind kind, BasisType basis_type) {
+            std::set<Var> variable_set;
+            size_t terms_count = 0;
+            for (const Polynom& p : polynomials) {
+                terms_count += p.size();
+                for (const Monom& m : p.get_monomials_ascending_order()) {
+                    for (const auto& [var, deg] : m.get_variables_ascending_order()) { variable_set.insert(var); }
+                }
+            }
+            std::vector<Var> variables(variable_set.begin(), variable_set.end());
+            Header header{};
+            std::memcpy(header.magic, kMagic, sizeof(kMagic));
+            header.version = kVersion;
+            header.kind = static_cast<uint16_t>(kind);
+            header.basis_type = static_cast<uint16_t>(basis_type);
+            header.coefficient_size = sizeof(CoefficientType);
+            header.coefficient_tag = get_coefficient_tag<CoefficientType>();
+            header.variables_count = variables.size();
+            header.coefficient_kind = static_cast<uint32_t>(get_coefficient_kind<CoefficientType>());
+            header.polynomials_count = polynomials.size();
+            header.terms_count = terms_count;
+            write_raw(os, &header, sizeof(header));
+            for (const Var& var : variables) {
+                VariableEntry entry{var.get_number(), var.get_letter(), 0};
+                write_raw(os, &entry, sizeof(entry));
+            }
+            uint64_t offset = 0;
+            write_raw(os, &offset, sizeof(offset));
+            for (const Polynom& p : polynomials) {
+                offset += p.size();
+                write_raw(os, &offset, sizeof(offset));
+            }
+            for (const Polynom& p : polynomials) {
+                for (const Monom& m : p.get_monomials_ascending_order()) {
+                    CoefficientType coefficient = m.get_coefficient();
+                    write_raw(os, &coefficient, sizeof(coefficient));
+                }
+            }
+            write_padding(os, terms_count * sizeof(CoefficientType));
+            std::vector<uint32_t> row(variables.size());
+            for (const Polynom& p : polynomials) {
+                for (const Monom& m : p.get_monomials_ascending_order()) {
+                    std::fill(row.begin(), row.end(), 0);
+                    for (const auto& [var, deg] : m.get_variables_ascending_order()) {
+                        assert(0 < deg && deg <= std::numeric_limits<uint32_t>::max() && "Degree doesn't fit");
+                        row[std::lower_bound(variables.begin(), variables.end(), var) - variables.begin()] = deg;
+                    }
+                    write_raw(os, row.data(), row.size() * sizeof(uint32_t));
+                }
+            }
+            write_padding(os, terms_count * variables.size() * sizeof(uint32_t));
+        }
+
+        static const char* read(std::istream& is, Kind kind, std::vector<Polynom>* polynomials,
+                                BasisType* basis_type) {
+            Header header;
+            if (!read_raw(is, &header, sizeof(header))) { return "Unexpected end of input"; }
+            if (const char* error = check_header(header, kind)) { return error; }
+            //Sections are sized by the layout, which fits into size_t, and read in chunks, so a corrupted count
+            //fails at the end of input instead of allocating memory for it
+            Layout layout(header);
+            if (!layout.is_valid) { return "Bad sizes"; }
+            std::vector<VariableEntry> entries;
+            if (!read_vector(is, header.variables_count, &entries)) { return "Unexpected end of input"; }
+            std::vector<Var> variables;
+            if (const char* error = read_variables(entries.data(), header.variables_count, &variables)) {
+                return error;
+            }
+            std::vector<uint64_t> offsets;
+            if (!read_vector(is, header.polynomials_count + 1, &offsets)) { return "Unexpected end of input"; }
+            if (const char* error = check_offsets(offsets.data(), header)) { return error; }
+            std::vector<CoefficientType> coefficients;
+            if (!read_vector(is, header.terms_count, &coefficients) || !skip_padding(is, layout.coefficients_size)) {
+                return "Unexpected end of input";
+            }
+            polynomials->clear();
+            std::vector<uint32_t> exponents;
+            for (size_t i = 0; i < header.polynomials_count; ++i) {
+                size_t terms = offsets[i + 1] - offsets[i];
+                if (!read_vector(is, terms * variables.size(), &exponents)) { return "Unexpected end of input"; }
+                if (const char* error = build(coefficients.data() + offsets[i], exponents.data(), terms, variables,
+                                              &polynomials->emplace_back())) {
+                    return error;
+                }
+            }
+            if (!skip_padding(is, layout.exponents_size)) { return "Unexpected end of input"; }
+            *basis_type = static_cast<BasisType>(header.basis_type);
+            return nullptr;
+        }
+
+        static const char* check_header(const Header& header, Kind kind) {
+            if (std::memcmp(header.magic, kMagic, sizeof(kMagic)) != 0) { return "Not a serialized polynomial data"; }
+            if (header.version != kVersion) { return "Unsupported format version"; }
+            if (header.kind != static_cast<uint16_t>(kind)) { return "Unexpected kind of serialized object"; }
+            if (header.basis_type > BasisType::ReducedGroebner) { return "Bad basis type"; }
+            if (header.coefficient_size != sizeof(CoefficientType) ||
+                header.coefficient_kind != static_cast<uint32_t>(get_coefficient_kind<CoefficientType>()) ||
+                header.coefficient_tag != get_coefficient_tag<CoefficientType>()) {
+                return "Coefficient type doesn't match";
+            }
+            if (kind == Kind::Polynomial && header.polynomials_count != 1) { return "Expected a single polynomial"; }
+            return nullptr;
+        }
+
+        static const char* read_variables(const VariableEntry* entries, size_t count, std::vector<Var>* variables) {
+            using NumberType = decltype(std::declval<Var>().get_number());
+            variables->clear();
+            for (size_t i = 0; i < count; ++i) {
+                int32_t letter = entries[i].letter;
+                if (letter < 0 || letter > 127 || !std::isalpha(letter)) { return "Bad variable"; }
+                variables->emplace_back(static_cast<char>(letter),
+                                        static_cast<NumberType>(entries[i].number));
+                if (i > 0 && !((*variables)[i - 1] < (*variables)[i])) { return "Variables are not sorted"; }
+            }
+            return nullptr;
+        }
+
+        static const char* check_offsets(const uint64_t* offsets, const Header& header) {
+            if (offsets[0] != 0 || offsets[header.polynomials_count] != header.terms_count) { return "Bad offsets"; }
+            for (size_t i = 0; i < header.polynomials_count; ++i) {
+                if (offsets[i] > offsets[i + 1]) { return "Bad offsets"; }
+            }
+            return nullptr;
+        }
+
+        //Builds polynomial from raw coefficients and exponent rows of its terms. Coefficients must be canonical
+        //nonzero values, degrees must fit into the monomial and terms must go in increasing order.
+        static const char* build(const void* coefficients, const uint32_t* exponents, size_t terms,
+                                 const std::vector<Var>& variables, Polynom* res) {
+            *res = Polynom();
+            std::vector<std::pair<Var, DegreeType>> powers;
+            for (size_t j = 0; j < terms; ++j) {
+                CoefficientType coefficient;
+                std::memcpy(&coefficient, static_cast<const char*>(coefficients) + j * sizeof(CoefficientType),
+                            sizeof(CoefficientType));
+                if (!is_valid_coefficient(coefficient)) { return "Bad coefficient"; }
+                powers.clear();
+                DegreeType degree = 0;
+                for (size_t k = 0; k < variables.size(); ++k) {
+                    uint32_t deg = exponents[j * variables.size() + k];
+                    if (!deg) { continue; }
+                    if (!is_valid_exponent(deg) || __builtin_add_overflow(degree, DegreeType(deg), &degree)) {
+                        return "Bad exponent";
+                    }
+                    powers.emplace_back(variables[k], deg);
+                }
+                if constexpr (requires { Monom::kMaxDegree; }) {
+                    if (degree > Monom::kMaxDegree) { return "Bad exponent"; }
+                }
+                Monom m(coefficient, powers);
+                if (!res->is_zero() && !MonomialOrder()(res->get_highest_monomial(), m)) { return "Bad terms"; }
+                res->append_highest_monomial(std::move(m));
+            }
+            return nullptr;
+        }
+
+    private:
+        static bool is_valid_coefficient(const CoefficientType& c) {
+            if constexpr (requires { c.get_denominator(); }) {
+                using T = decltype(c.get_numerator());
+                T numerator = c.get_numerator(), denominator = c.get_denominator();
+                return numerator != 0 && numerator != std::numeric_limits<T>::min() && denominator > 0 &&
+                       std::gcd(numerator, denominator) == 1;
+            } else if constexpr (requires { CoefficientType::get_modulus(); }) {
+                return 0 < c.get_value() && c.get_value() < CoefficientType::get_modulus();
+            } else if constexpr (std::is_same_v<CoefficientType, GF2>) {
+                return c == GF2(1);
+            } else {
+                return c != CoefficientType(0);
+            }
+        }
+
+        static bool is_valid_exponent(uint32_t deg) {
+            if constexpr (requires { Monom::kMaxExponent; }) {
+                return deg <= Monom::kMaxExponent;
+            } else {
+                return deg <= static_cast<uint64_t>(std::numeric_limits<DegreeType>::max());
+            }
+        }
+
+        static void write_raw(std::ostream& os, const void* data, size_t size) {
+            os.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+        }
+
+        static void write_padding(std::ostream& os, size_t bytes) {
+            constexpr char kZeros[kAlignment] = {};
+            write_raw(os, kZeros, get_padding(bytes));
+        }
+
+        static bool read_raw(std::istream& is, void* data, size_t size) {
+            is.read(static_cast<char*>(data), static_cast<std::streamsize>(size));
+            return static_cast<size_t>(is.gcount()) == size;
+        }
+
+        static bool skip_padding(std::istream& is, size_t bytes) {
+            char padding[kAlignment];
+            return read_raw(is, padding, get_padding(bytes));
+        }
+
+        //Memory grows with the data actually read, not with the count
+        template<typename T>
+        static bool read_vector(std::istream& is, size_t count, std::vector<T>* res) {
+            constexpr size_t kChunk = std::max<size_t>((size_t(1) << 16) / sizeof(T), 1);
+            res->clear();
+            while (res->size() < count) {
+                size_t begin = res->size();
+                res->resize(begin + std::min(count - begin, kChunk));
+                if (!read_raw(is, res->data() + begin, (res->size() - begin) * sizeof(T))) { return false; }
+            }
+            return true;
+        }
+    };
+
+    //Polynomials read in place from serialized data, e.g. from a mapped file, which must outlive the view
+    template<typename Polynom>
+    class View {
+        using Var = typename Polynom::Monom_::Variable_;
+
+    public:
+        View(std::string_view data, Kind kind) {
+            if (reinterpret_cast<uintptr_t>(data.data()) % kAlignment != 0) {
+                error_ = "Serialized data must be aligned to 8 bytes";
+                return;
+            }
+            if (data.size() < sizeof(Header)) {
+                error_ = "Unexpected end of input";
+                return;
+            }
+            std::memcpy(&header_, data.data(), sizeof(Header));
+            if ((error_ = Codec<Polynom>::check_header(header_, kind))) { return; }
+            Layout layout(header_);
+            if (!layout.is_valid) {
+                error_ = "Bad sizes";
+                return;
+            }
+            if (data.size() < layout.end) {
+                error_ = "Unexpected end of input";
+                return;
+            }
+            auto entries = reinterpret_cast<const VariableEntry*>(data.data() + layout.variables);
+            if ((error_ = Codec<Polynom>::read_variables(entries, header_.variables_count, &variables_))) { return; }
+            offsets_ = reinterpret_cast<const uint64_t*>(data.data() + layout.offsets);
+            if ((error_ = Codec<Polynom>::check_offsets(offsets_, header_))) { return; }
+            coefficients_ = data.data() + layout.coefficients;
+            exponents_ = reinterpret_cast<const uint32_t*>(data.data() + layout.exponents);
+        }
+
+        //nullptr if data is valid
+        const char* get_error() const { return error_; }
+
+        size_t size() const { return error_ ? 0 : header_.polynomials_count; }
+
+        BasisType get_basis_type() const { return static_cast<BasisType>(header_.basis_type); }
+
+        const std::vector<Var>& get_variables() const { return variables_; }
+
+        size_t get_terms_count(size_t i) const { return offsets_[i + 1] - offsets_[i]; }
+
+        //Terms are validated only here, returns nullptr or error message like readers do
+        const char* get_polynomial(size_t i, Polynom* p) const {
+            assert(i < size());
+            return Codec<Polynom>::build(coefficients_ + offsets_[i] * header_.coefficient_size,
+                                         exponents_ + offsets_[i] * variables_.size(), get_terms_count(i),
+                                         variables_, p);
+        }
+
+    private:
+        const char* error_ = nullptr;
+        Header header_{};
+        std::vector<Var> variables_;
+        const uint64_t* offsets_ = nullptr;
+        const char* coefficients_ = nullptr;
+        const uint32_t* exponents_ = nullptr;
+    };
+
+    template<typename Monom, typename MonomialOrder>
+    void write(std::ostream& os, const Polynomial<Monom, MonomialOrder>& p) {
+        using Polynom = Polynomial<Monom, MonomialOrder>;
+        Codec<Polynom>::write(os, std::span<const Polynom>(&p, 1), Kind::Polynomial, BasisType::Any);
+    }
+
+    template<typename Polynom>
+    void write(std::ostream& os, const Ideal<Polynom>& ideal) {
+        Codec<Polynom>::write(os, ideal.get_basis(), Kind::Ideal, ideal.get_basis_type());
+    }
+
+    //Readers return nullptr on success or error message, then output is left unspecified
+    template<typename Monom, typename MonomialOrder>
+    const char* read(std::istream& is, Polynomial<Monom, MonomialOrder>* p) {
+        std::vector<Polynomial<Monom, MonomialOrder>> polynomials;
+        BasisType basis_type;
+        const char* error = Codec<Polynomial<Monom, MonomialOrder>>::read(is, Kind::Polynomial, &polynomials,
+                                                                          &basis_type);
+        if (!error) { *p = std::move(polynomials[0]); }
+        return error;
+    }
+
+    template<typename Polynom>
+    const char* read(std::istream& is, Ideal<Polynom>* ideal) {
+        std::vector<Polynom> polynomials;
+        BasisType basis_type;
+        const char* error = Codec<Polynom>::read(is, Kind::Ideal, &polynomials, &basis_type);
+        if (!error) { ideal->assign_basis(std::move(polynomials), basis_type); }
+        return error;
+    }
+
+    template<typename Polynom>
+    bool save(const std::string& path, const Ideal<Polynom>& ideal) {
+        std::ofstream out(path, std::ios::binary);
+        write(out, ideal);
+        return static_cast<bool>(out.flush());
+    }
+
+    //Maps the file and builds the basis straight from its sections
+    template<typename Polynom>
+    const char* load(const std::string& path, Ideal<Polynom>* ideal) {
+        MappedFile file(path);
+        if (!file.is_open()) { return "Can't read file"; }
+        View<Polynom> view(file.get_view(), Kind::Ideal);
+        if (view.get_error()) { return view.get_error(); }
+        std::vector<Polynom> polynomials;
+        polynomials.reserve(view.size());
+        for (size_t i = 0; i < view.size(); ++i) {
+            if (const char* error = view.get_polynomial(i, &polynomials.emplace_back())) { return error; }
+        }
+        ideal->assign_basis(std::move(polynomials), view.get_basis_type());
+        return nullptr;
+    }
+}// namespace serialization
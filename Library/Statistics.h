@@ -0,0 +1,151 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+//Instrumentation of Groebner computations. It's compiled in only when GROEBNER_STATISTICS is defined,
+//otherwise Recorder is an empty type with empty inline hooks, and statistics stay zero.
+namespace instrumentation {
+#ifdef GROEBNER_STATISTICS
+    constexpr bool kEnabled = true;
+#else
+    constexpr bool kEnabled = false;
+#endif
+
+    enum Phase { GroebnerBasis, Reduction, ExcludeUnnecessary, ReduceEach, kPhasesCount };
+
+    constexpr const char* kPhaseNames[kPhasesCount] = {"make_groebner_basis", "reduce",
+                                                       "exclude_unnecessary_polinomials", "reduce_each"};
+
+    //Trace keeps only first events, reduce alone is called for every S-polynomial
+    constexpr size_t kMaxTraceEvents = 1 << 16;
+
+    struct PhaseTime {
+        uint64_t calls = 0;
+        std::chrono::nanoseconds total{0};
+    };
+
+    struct TraceEvent {
+        Phase phase;
+        //Since creation of the recorder
+        std::chrono::nanoseconds start;
+        std::chrono::nanoseconds duration;
+    };
+
+    struct Statistics {
+        uint64_t pairs_generated = 0;
+        uint64_t coprime_pairs = 0;
+        uint64_t zero_reductions = 0;
+        uint64_t reduction_steps = 0;
+        uint64_t max_basis_size = 0;
+        uint64_t s_polynomial_terms = 0;
+        uint64_t remainder_terms = 0;
+        std::array<PhaseTime, kPhasesCount> phases{};
+        std::vector<TraceEvent> trace;
+
+        void write_json(std::ostream& os) const {
+            os << "{\"pairs_generated\": " << pairs_generated << ", \"coprime_pairs\": " << coprime_pairs
+               << ", \"zero_reductions\": " << zero_reductions << ", \"reduction_steps\": " << reduction_steps
+               << ", \"max_basis_size\": " << max_basis_size << ", \"s_polynomial_terms\": " << s_polynomial_terms
+               << ", \"remainder_terms\": " << remainder_terms << ", \"phases\": {";
+            for (size_t i = 0; i < kPhasesCount; ++i) {
+                os << (i ? ", " : "") << '"' << kPhaseNames[i] << "\": {\"calls\": " << phases[i].calls
+                   << ", \"total_ns\": " << phases[i].total.count() << "}";
+            }
+            os << "}}";
+        }
+
+        //Trace Event Format of chrome://tracing and Perfetto, times are in microseconds
+        void write_chrome_trace(std::ostream& os) const {
+            os << "{\"traceEvents\": [";
+            for (size_t i = 0; i < trace.size(); ++i) {
+                const auto& [phase, start, duration] = trace[i];
+                os << (i ? ",\n" : "\n") << "{\"name\": \"" << kPhaseNames[phase]
+                   << "\", \"ph\": \"X\", \"pid\": 0, \"tid\": 0, \"ts\": " << start.count() / 1000.0
+                   << ", \"dur\": " << duration.count() / 1000.0 << "}";
+            }
+            os << "\n], \"displayTimeUnit\": \"ns\"}";
+        }
+    };
+
+    template<bool Enabled>
+    class Recorder;
+
+    template<>
+    class Recorder<true> {
+        using Clock = std::chrono::steady_clock;
+
+    public:
+        class Timer {
+        public:
+            Timer(Recorder* recorder, Phase phase) : recorder_(recorder), phase_(phase), start_(Clock::now()) {}
+
+            Timer(const Timer&) = delete;
+            Timer& operator=(const Timer&) = delete;
+
+            ~Timer() { recorder_->record(phase_, start_, Clock::now()); }
+
+        private:
+            Recorder* recorder_;
+            Phase phase_;
+            Clock::time_point start_;
+        };
+
+        const Statistics& get() const { return statistics_; }
+
+        void reset() { statistics_ = {}; }
+
+        [[nodiscard]] Timer time(Phase phase) { return Timer(this, phase); }
+
+        void count_pair() { ++statistics_.pairs_generated; }
+        void count_coprime_pair() { ++statistics_.coprime_pairs; }
+        void count_zero_reduction() { ++statistics_.zero_reductions; }
+        void count_reduction_step() { ++statistics_.reduction_steps; }
+        void count_s_polynomial_terms(size_t terms) { statistics_.s_polynomial_terms += terms; }
+        void count_remainder_terms(size_t terms) { statistics_.remainder_terms += terms; }
+
+        void observe_basis_size(size_t size) {
+            statistics_.max_basis_size = std::max<uint64_t>(statistics_.max_basis_size, size);
+        }
+
+    private:
+        void record(Phase phase, Clock::time_point start, Clock::time_point end) {
+            ++statistics_.phases[phase].calls;
+            statistics_.phases[phase].total += end - start;
+            if (statistics_.trace.size() < kMaxTraceEvents) {
+                statistics_.trace.push_back({phase, start - origin_, end - start});
+            }
+        }
+
+        Statistics statistics_;
+        Clock::time_point origin_ = Clock::now();
+    };
+
+    template<>
+    class Recorder<false> {
+    public:
+        struct Timer {};
+
+        const Statistics& get() const {
+            static const Statistics empty;
+            return empty;
+        }
+
+        void reset() {}
+
+        [[nodiscard]] Timer time(Phase) { return {}; }
+
+        void count_pair() {}
+        void count_coprime_pair() {}
+        void count_zero_reduction() {}
+        void count_reduction_step() {}
+        void count_s_polynomial_terms(size_t) {}
+        void count_remainder_terms(size_t) {}
+        void observe_basis_size(size_t) {}
+    };
+
+    using ActiveRecorder = Recorder<kEnabled>;
+}// namespace instrumentation
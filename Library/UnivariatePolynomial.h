@@ -0,0 +1,449 @@
+#pragma once
+#include "Polynomial.h"
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <random>
+#include <vector>
+
+namespace ntt {
+    //Roots of unity of order 2^k for prime field F_p, exist for k up to the power of two dividing p - 1
+    template<typename Mint>
+    struct RootsOfUnity {
+        static const RootsOfUnity& get() {
+            static const RootsOfUnity roots;
+            return roots;
+        }
+
+        size_t max_log = 0;
+        //roots[k] is a primitive root of unity of order 2^k
+        std::vector<Mint> roots;
+
+    private:
+        RootsOfUnity() {
+            using T = decltype(Mint::get_modulus());
+            const T p = Mint::get_modulus();
+            if (p == 2) { return; }
+            T odd_part = p - 1;
+            for (; odd_part % 2 == 0; odd_part /= 2) { ++max_log; }
+            std::vector<T> prime_divisors;
+            T rest = p - 1;
+            for (T d = 2; d * d <= rest; ++d) {
+                if (rest % d) { continue; }
+                prime_divisors.push_back(d);
+                while (rest % d == 0) { rest /= d; }
+            }
+            if (rest > 1) { prime_divisors.push_back(rest); }
+            T generator = 2;
+            auto is_generator = [&](T g) {
+                for (T d : prime_divisors) {
+                    if (pow(Mint(g), (p - 1) / d) == 1) { return false; }
+                }
+                return true;
+            };
+            while (!is_generator(generator)) { ++generator; }
+            roots.resize(max_log + 1);
+            roots[max_log] = pow(Mint(generator), odd_part);
+            for (size_t k = max_log; k > 0; --k) { roots[k - 1] = roots[k] * roots[k]; }
+        }
+    };
+
+    //In-place iterative number theoretic transform, size of a must be a power of two
+    template<typename Mint>
+    void transform(std::vector<Mint>& a, bool inverse) {
+        const size_t n = a.size();
+        for (size_t i = 1, j = 0; i < n; ++i) {
+            size_t bit = n >> 1;
+            for (; j & bit; bit >>= 1) { j ^= bit; }
+            j ^= bit;
+            if (i < j) { std::swap(a[i], a[j]); }
+        }
+        const auto& roots = RootsOfUnity<Mint>::get().roots;
+        for (size_t len = 2, k = 1; len <= n; len <<= 1, ++k) {
+            Mint step = inverse ? invert(roots[k]) : roots[k];
+            std::vector<Mint> powers(len / 2);
+            powers[0] = 1;
+            for (size_t i = 1; i < len / 2; ++i) { powers[i] = powers[i - 1] * step; }
+            for (size_t i = 0; i < n; i += len) {
+                for (size_t j = 0; j < len / 2; ++j) {
+                    Mint u = a[i + j], v = a[i + j + len / 2] * powers[j];
+                    a[i + j] = u + v;
+                    a[i + j + len / 2] = u - v;
+                }
+            }
+        }
+        if (inverse) {
+            Mint inverse_n = invert(Mint(static_cast<int64_t>(n)));
+            for (auto& x : a) { x *= inverse_n; }
+        }
+    }
+
+    //Returns false if the field has no roots of unity of the required order
+    template<typename Mint>
+    bool multiply(const std::vector<Mint>& lhs, const std::vector<Mint>& rhs, std::vector<Mint>* res) {
+        size_t result_size = lhs.size() + rhs.size() - 1;
+        size_t n = 1, log = 0;
+        for (; n < result_size; n <<= 1) { ++log; }
+        if (log > RootsOfUnity<Mint>::get().max_log) { return false; }
+        std::vector<Mint> a(lhs), b(rhs);
+        a.resize(n);
+        b.resize(n);
+        transform(a, false);
+        transform(b, false);
+        for (size_t i = 0; i < n; ++i) { a[i] *= b[i]; }
+        transform(a, true);
+        a.resize(result_size);
+        *res = std::move(a);
+        return true;
+    }
+}// namespace ntt
+
+//Dense polynomial of one variable over a field, coefficients are stored from the lowest degree to the highest.
+//Zero polynomial has no coefficients, so the highest stored coefficient is never zero.
+//Over NTT-friendly prime fields large products use number theoretic transform and division uses Newton iteration.
+template<typename CoefficientType>
+class UnivariatePolynomial {
+public:
+    UnivariatePolynomial() = default;
+
+    UnivariatePolynomial(const CoefficientType& c) {
+        if (c != 0) { coefficients_.push_back(c); }
+    }
+
+    explicit UnivariatePolynomial(std::vector<CoefficientType> coefficients) : coefficients_(std::move(coefficients)) {
+        trim();
+    }
+
+    //Returns c * x^degree
+    static UnivariatePolynomial Power(size_t degree, const CoefficientType& c = CoefficientType(1)) {
+        if (c == 0) { return {}; }
+        std::vector<CoefficientType> coefficients(degree + 1, CoefficientType(0));
+        coefficients[degree] = c;
+        return UnivariatePolynomial(std::move(coefficients));
+    }
+
+    UnivariatePolynomial& operator+=(const UnivariatePolynomial& rhs) {
+        if (coefficients_.size() < rhs.coefficients_.size()) { coefficients_.resize(rhs.coefficients_.size()); }
+        for (size_t i = 0; i < rhs.coefficients_.size(); ++i) { coefficients_[i] += rhs.coefficients_[i]; }
+        trim();
+        return *this;
+    }
+    friend UnivariatePolynomial operator+(const UnivariatePolynomial& lhs, const UnivariatePolynomial& rhs) {
+        UnivariatePolynomial res = lhs;
+        res += rhs;
+        return res;
+    }
+
+    UnivariatePolynomial& operator-=(const UnivariatePolynomial& rhs) {
+        if (coefficients_.size() < rhs.coefficients_.size()) { coefficients_.resize(rhs.coefficients_.size()); }
+        for (size_t i = 0; i < rhs.coefficients_.size(); ++i) { coefficients_[i] -= rhs.coefficients_[i]; }
+        trim();
+        return *this;
+    }
+    friend UnivariatePolynomial operator-(const UnivariatePolynomial& lhs, const UnivariatePolynomial& rhs) {
+        UnivariatePolynomial res = lhs;
+        res -= rhs;
+        return res;
+    }
+
+    UnivariatePolynomial operator-() const { return UnivariatePolynomial() - *this; }
+
+    UnivariatePolynomial& operator*=(const CoefficientType& rhs) {
+        if (rhs == 0) {
+            coefficients_.clear();
+        } else {
+            for (auto& c : coefficients_) { c *= rhs; }
+        }
+        return *this;
+    }
+    friend UnivariatePolynomial operator*(const UnivariatePolynomial& lhs, const CoefficientType& rhs) {
+        UnivariatePolynomial res = lhs;
+        res *= rhs;
+        return res;
+    }
+
+    UnivariatePolynomial& operator*=(const UnivariatePolynomial& rhs) {
+        if (is_zero() || rhs.is_zero()) {
+            coefficients_.clear();
+            return *this;
+        }
+        if constexpr (is_mint<CoefficientType>::value) {
+            if (std::min(coefficients_.size(), rhs.coefficients_.size()) >= kFastArithmeticThreshold &&
+                ntt::multiply(coefficients_, rhs.coefficients_, &coefficients_)) {
+                trim();
+                return *this;
+            }
+        }
+        std::vector<CoefficientType> res(coefficients_.size() + rhs.coefficients_.size() - 1, CoefficientType(0));
+        for (size_t i = 0; i < coefficients_.size(); ++i) {
+            if (coefficients_[i] == 0) { continue; }
+            for (size_t j = 0; j < rhs.coefficients_.size(); ++j) {
+                res[i + j] += coefficients_[i] * rhs.coefficients_[j];
+            }
+        }
+        coefficients_ = std::move(res);
+        trim();
+        return *this;
+    }
+    friend UnivariatePolynomial operator*(const UnivariatePolynomial& lhs, const UnivariatePolynomial& rhs) {
+        UnivariatePolynomial res = lhs;
+        res *= rhs;
+        return res;
+    }
+
+    //Division with remainder: lhs = quotient * rhs + remainder, deg(remainder) < deg(rhs)
+    friend std::pair<UnivariatePolynomial, UnivariatePolynomial> divide(const UnivariatePolynomial& lhs,
+                                                                        const UnivariatePolynomial& rhs) {
+        assert(!rhs.is_zero() && "Division by zero!");
+        if (lhs.coefficients_.size() < rhs.coefficients_.size()) { return {UnivariatePolynomial(), lhs}; }
+        size_t quotient_size = lhs.coefficients_.size() - rhs.coefficients_.size() + 1;
+        if (std::min(quotient_size, rhs.coefficients_.size()) >= kFastArithmeticThreshold) {
+            //rev(lhs) = rev(quotient) * rev(rhs) mod x^quotient_size, where rev reverses coefficients
+            UnivariatePolynomial reversed_quotient =
+                    (lhs.reversed().truncated(quotient_size) * rhs.reversed().inverse_series(quotient_size))
+                            .truncated(quotient_size);
+            std::vector<CoefficientType> quotient = reversed_quotient.coefficients_;
+            quotient.resize(quotient_size, CoefficientType(0));
+            std::reverse(quotient.begin(), quotient.end());
+            UnivariatePolynomial q(std::move(quotient));
+            return {q, lhs - q * rhs};
+        }
+        std::vector<CoefficientType> remainder = lhs.coefficients_;
+        std::vector<CoefficientType> quotient(lhs.coefficients_.size() - rhs.coefficients_.size() + 1);
+        CoefficientType inverse_leading = invert(rhs.get_leading_coefficient());
+        size_t rhs_degree = rhs.get_degree();
+        for (size_t i = quotient.size(); i-- > 0;) {
+            CoefficientType factor = remainder[i + rhs_degree] * inverse_leading;
+            quotient[i] = factor;
+            if (factor == 0) { continue; }
+            for (size_t j = 0; j <= rhs_degree; ++j) { remainder[i + j] -= factor * rhs.coefficients_[j]; }
+        }
+        remainder.resize(rhs_degree);
+        return {UnivariatePolynomial(std::move(quotient)), UnivariatePolynomial(std::move(remainder))};
+    }
+
+    UnivariatePolynomial& operator/=(const UnivariatePolynomial& rhs) { return *this = divide(*this, rhs).first; }
+    friend UnivariatePolynomial operator/(const UnivariatePolynomial& lhs, const UnivariatePolynomial& rhs) {
+        return divide(lhs, rhs).first;
+    }
+
+    UnivariatePolynomial& operator%=(const UnivariatePolynomial& rhs) { return *this = divide(*this, rhs).second; }
+    friend UnivariatePolynomial operator%(const UnivariatePolynomial& lhs, const UnivariatePolynomial& rhs) {
+        return divide(lhs, rhs).second;
+    }
+
+    bool operator==(const UnivariatePolynomial& rhs) const { return coefficients_ == rhs.coefficients_; }
+    friend bool operator!=(const UnivariatePolynomial& lhs, const UnivariatePolynomial& rhs) { return !(lhs == rhs); }
+
+    bool is_zero() const { return coefficients_.empty(); }
+
+    //Degree of zero polynomial is 0, check is_zero() to distinguish it from constants
+    size_t get_degree() const { return is_zero() ? 0 : coefficients_.size() - 1; }
+
+    CoefficientType get_leading_coefficient() const { return is_zero() ? CoefficientType(0) : coefficients_.back(); }
+
+    CoefficientType operator[](size_t degree) const {
+        return degree < coefficients_.size() ? coefficients_[degree] : CoefficientType(0);
+    }
+
+    const std::vector<CoefficientType>& get_coefficients() const { return coefficients_; }
+
+    CoefficientType evaluate(const CoefficientType& x) const {
+        CoefficientType res = 0;
+        for (size_t i = coefficients_.size(); i-- > 0;) { res = res * x + coefficients_[i]; }
+        return res;
+    }
+
+    UnivariatePolynomial derivative() const {
+        std::vector<CoefficientType> res;
+        for (size_t i = 1; i < coefficients_.size(); ++i) {
+            res.push_back(coefficients_[i] * CoefficientType(static_cast<int64_t>(i)));
+        }
+        return UnivariatePolynomial(std::move(res));
+    }
+
+    void normalize() {
+        if (!is_zero()) { *this *= invert(get_leading_coefficient()); }
+    }
+
+    //Computes base^power modulo this polynomial by binary exponentiation
+    UnivariatePolynomial pow_mod(UnivariatePolynomial base, uint64_t power) const {
+        UnivariatePolynomial res = UnivariatePolynomial(CoefficientType(1)) % *this;
+        for (base %= *this; power; power >>= 1) {
+            if (power & 1) { res = res * base % *this; }
+            base = base * base % *this;
+        }
+        return res;
+    }
+
+    //Computes first n coefficients of 1 / this by Newton iteration g = g * (2 - this * g).
+    //Constant term must be nonzero
+    UnivariatePolynomial inverse_series(size_t n) const {
+        assert((*this)[0] != 0 && "Power series with zero constant term isn't invertible");
+        UnivariatePolynomial res(invert((*this)[0]));
+        for (size_t len = 1; len < n;) {
+            len = std::min(len * 2, n);
+            UnivariatePolynomial correction = (truncated(len) * res).truncated(len);
+            res = (res * (UnivariatePolynomial(CoefficientType(2)) - correction)).truncated(len);
+        }
+        return res.truncated(n);
+    }
+
+    //Evaluates at all points by remaindering down the subproduct tree of (x - point)
+    std::vector<CoefficientType> evaluate(const std::vector<CoefficientType>& points) const {
+        std::vector<CoefficientType> res(points.size());
+        if (points.empty()) { return res; }
+        std::vector<UnivariatePolynomial> tree(4 * points.size());
+        build_subproduct_tree(points, 1, 0, points.size(), &tree);
+        evaluate_on_subtree(*this % tree[1], points, 1, 0, points.size(), tree, &res);
+        return res;
+    }
+
+    //Monic greatest common divisor
+    friend UnivariatePolynomial gcd(UnivariatePolynomial p1, UnivariatePolynomial p2) {
+        while (!p2.is_zero()) {
+            p1 %= p2;
+            std::swap(p1, p2);
+        }
+        p1.normalize();
+        return p1;
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const UnivariatePolynomial& p) {
+        if (p.is_zero()) { return os << "0"; }
+        bool is_first = true;
+        for (size_t i = p.coefficients_.size(); i-- > 0;) {
+            if (p.coefficients_[i] == 0) { continue; }
+            if (!is_first) { os << " + "; }
+            is_first = false;
+            if (p.coefficients_[i] != 1 || i == 0) { os << p.coefficients_[i]; }
+            if (i > 0) { os << "x"; }
+            if (i > 1) { os << "^" << i; }
+        }
+        return os;
+    }
+
+private:
+    //Below this size schoolbook algorithms are faster than transforms and Newton iterations
+    static constexpr size_t kFastArithmeticThreshold = 64;
+
+    void trim() {
+        while (!coefficients_.empty() && coefficients_.back() == 0) { coefficients_.pop_back(); }
+    }
+
+    UnivariatePolynomial truncated(size_t n) const {
+        if (coefficients_.size() <= n) { return *this; }
+        return UnivariatePolynomial(std::vector<CoefficientType>(coefficients_.begin(), coefficients_.begin() + n));
+    }
+
+    UnivariatePolynomial reversed() const {
+        return UnivariatePolynomial(std::vector<CoefficientType>(coefficients_.rbegin(), coefficients_.rend()));
+    }
+
+    static void build_subproduct_tree(const std::vector<CoefficientType>& points, size_t v, size_t l, size_t r,
+                                      std::vector<UnivariatePolynomial>* tree) {
+        if (r - l == 1) {
+            (*tree)[v] = UnivariatePolynomial(std::vector<CoefficientType>{-points[l], CoefficientType(1)});
+            return;
+        }
+        size_t m = (l + r) / 2;
+        build_subproduct_tree(points, 2 * v, l, m, tree);
+        build_subproduct_tree(points, 2 * v + 1, m, r, tree);
+        (*tree)[v] = (*tree)[2 * v] * (*tree)[2 * v + 1];
+    }
+
+    static void evaluate_on_subtree(const UnivariatePolynomial& p, const std::vector<CoefficientType>& points,
+                                    size_t v, size_t l, size_t r, const std::vector<UnivariatePolynomial>& tree,
+                                    std::vector<CoefficientType>* res) {
+        if (r - l <= kFastArithmeticThreshold) {
+            for (size_t i = l; i < r; ++i) { (*res)[i] = p.evaluate(points[i]); }
+            return;
+        }
+        size_t m = (l + r) / 2;
+        evaluate_on_subtree(p % tree[2 * v], points, 2 * v, l, m, tree, res);
+        evaluate_on_subtree(p % tree[2 * v + 1], points, 2 * v + 1, m, r, tree, res);
+    }
+
+    std::vector<CoefficientType> coefficients_;
+};
+
+namespace univariate_roots {
+    //Splits product of distinct linear factors into them using random gcd((x + a)^((p - 1) / 2) - 1, f)
+    template<typename Mint>
+    void split_linear_factors(const UnivariatePolynomial<Mint>& f, std::mt19937_64& rng, std::vector<Mint>* roots) {
+        using P = UnivariatePolynomial<Mint>;
+        if (f.get_degree() == 0) { return; }
+        if (f.get_degree() == 1) {
+            roots->push_back(-f[0] / f[1]);
+            return;
+        }
+        std::uniform_int_distribution<int64_t> gen(0, Mint::get_modulus() - 1);
+        while (true) {
+            P shifted(std::vector<Mint>{Mint(gen(rng)), Mint(1)});
+            P g = gcd(f.pow_mod(shifted, (Mint::get_modulus() - 1) / 2) - P(Mint(1)), f);
+            if (g.get_degree() == 0 || g.get_degree() == f.get_degree()) { continue; }
+            split_linear_factors(g, rng, roots);
+            split_linear_factors(f / g, rng, roots);
+            return;
+        }
+    }
+}// namespace univariate_roots
+
+//Returns all distinct roots in prime field F_p: first extracts product of linear factors gcd(x^p - x, f)
+//(distinct-degree step), then splits it by equal-degree factorization
+template<typename Mint>
+std::vector<Mint> find_roots(UnivariatePolynomial<Mint> f) {
+    static_assert(is_mint<Mint>::value, "Roots can be found only over prime fields");
+    using P = UnivariatePolynomial<Mint>;
+    assert(!f.is_zero() && "Every element is a root of zero polynomial");
+    std::vector<Mint> roots;
+    if (f.get_degree() == 0) { return roots; }
+    f.normalize();
+    if (Mint::get_modulus() == 2) {
+        for (int64_t x = 0; x < 2; ++x) {
+            if (f.evaluate(Mint(x)) == 0) { roots.push_back(Mint(x)); }
+        }
+        return roots;
+    }
+    P x = P::Power(1);
+    P linear_part = gcd(f.pow_mod(x, Mint::get_modulus()) - x, f);
+    std::mt19937_64 rng(777);
+    univariate_roots::split_linear_factors(linear_part, rng, &roots);
+    std::sort(roots.begin(), roots.end());
+    return roots;
+}
+
+//Converts polynomial of at most one variable, the variable is written to var if it's not null
+template<typename Polynom>
+UnivariatePolynomial<typename Polynom::Monom_::CoefficientType_>
+to_univariate(const Polynom& p, typename Polynom::Monom_::Variable_* var = nullptr) {
+    using CoefficientType = typename Polynom::Monom_::CoefficientType_;
+    std::vector<CoefficientType> coefficients;
+    std::optional<typename Polynom::Monom_::Variable_> variable;
+    for (const auto& m : p.get_monomials_ascending_order()) {
+        size_t degree = 0;
+        for (const auto& [v, deg] : m.get_variables_ascending_order()) {
+            assert(degree == 0 && (!variable || *variable == v) && "Polynomial must depend on at most one variable");
+            variable = v;
+            degree = deg;
+        }
+        if (coefficients.size() <= degree) { coefficients.resize(degree + 1, CoefficientType(0)); }
+        coefficients[degree] += m.get_coefficient();
+    }
+    if (var && variable) { *var = *variable; }
+    return UnivariatePolynomial<CoefficientType>(std::move(coefficients));
+}
+
+template<typename Polynom>
+Polynom from_univariate(const UnivariatePolynomial<typename Polynom::Monom_::CoefficientType_>& p,
+                        const typename Polynom::Monom_::Variable_& var) {
+    using Monom = typename Polynom::Monom_;
+    Polynom res;
+    const auto& coefficients = p.get_coefficients();
+    for (size_t i = 0; i < coefficients.size(); ++i) {
+        if (coefficients[i] != 0) { res += Monom(coefficients[i], var, static_cast<typename Monom::DegreeType_>(i)); }
+    }
+    return res;
+}
@@ -18,6 +18,9 @@ public:
         assert(('a' <= letter && letter <= 'z') || ('A' <= letter && letter <= 'Z') && "Expected [A-Za-z] letter");
     }
 
+    char get_letter() const { return letter_; }
+    NumberType get_number() const { return number_; }
+
     bool operator==(const Variable& rhs) const { return letter_ == rhs.letter_ && number_ == rhs.number_; }
     friend bool operator!=(const Variable& lhs, const Variable& rhs) { return !(lhs == rhs); }
 
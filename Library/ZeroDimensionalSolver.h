@@ -0,0 +1,174 @@
+#pragma once
+#include "QuotientRing.h"
+#include "UnivariatePolynomial.h"
+
+//Finds all points of a zero-dimensional variety over a prime field.
+//Lex basis is obtained from the basis in the polynomial's own (usually cheaper) order by FGLM conversion
+//in the quotient ring, then roots of the univariate eliminant are back-substituted variable by variable.
+template<typename Polynom>
+class ZeroDimensionalSolver {
+    using Monom = typename Polynom::Monom_;
+    using CoefficientType = typename Monom::CoefficientType_;
+    using Var = typename Monom::Variable_;
+    static_assert(is_mint<CoefficientType>::value, "Solver works only over prime fields");
+
+public:
+    using LexPolynom = Polynomial<Monom, MonomialOrders::Lex>;
+    using Solution = std::map<Var, CoefficientType>;
+
+    //For a positive-dimensional ideal get_error() is set, lex basis and solutions are empty
+    explicit ZeroDimensionalSolver(const Ideal<Polynom>& ideal) : ring_(ideal) {
+        if (!get_error()) { convert_to_lex(); }
+    }
+
+    const char* get_error() const { return ring_.get_error(); }
+
+    //Reduced Groebner basis in Lex order, its smallest variable is eliminated last
+    const std::vector<LexPolynom>& get_lex_basis() const { return lex_basis_; }
+
+    const QuotientRing<Polynom>& get_quotient_ring() const { return ring_; }
+
+    //All solutions with coordinates in the prime field, sorted lexicographically
+    std::vector<Solution> solve() const {
+        const auto& variables = ring_.get_variables();
+        if (ring_.dimension() == 0) { return {}; }
+        std::vector<std::vector<CoefficientType>> partial = {{}};
+        //Variables are sorted in increasing order, so lex basis restricted to first k of them
+        //is a Groebner basis of the k-th elimination ideal
+        for (size_t k = 0; k < variables.size(); ++k) {
+            std::vector<const LexPolynom*> eliminants;
+            for (const LexPolynom& g : lex_basis_) {
+                if (get_largest_variable_index(g) == k) { eliminants.push_back(&g); }
+            }
+            std::vector<std::vector<CoefficientType>> extended;
+            for (const auto& values : partial) {
+                UnivariatePolynomial<CoefficientType> common;
+                for (const LexPolynom* g : eliminants) { common = gcd(common, substitute(*g, values, k)); }
+                for (const CoefficientType& root : find_roots(common)) {
+                    extended.push_back(values);
+                    extended.back().push_back(root);
+                }
+            }
+            partial = std::move(extended);
+        }
+        std::sort(partial.begin(), partial.end());
+        std::vector<Solution> res;
+        for (const auto& values : partial) {
+            Solution solution;
+            for (size_t k = 0; k < variables.size(); ++k) { solution[variables[k]] = values[k]; }
+            res.push_back(std::move(solution));
+        }
+        return res;
+    }
+
+private:
+    size_t get_variable_index(const Var& var) const {
+        const auto& variables = ring_.get_variables();
+        return std::lower_bound(variables.begin(), variables.end(), var) - variables.begin();
+    }
+
+    size_t get_largest_variable_index(const LexPolynom& g) const {
+        size_t res = 0;
+        for (const Monom& m : g.get_monomials_ascending_order()) {
+            for (const auto& [var, deg] : m.get_variables_ascending_order()) {
+                res = std::max(res, get_variable_index(var));
+            }
+        }
+        return res;
+    }
+
+    //Substitutes values of variables with indices less than k and returns univariate polynomial in k-th variable
+    UnivariatePolynomial<CoefficientType> substitute(const LexPolynom& g, const std::vector<CoefficientType>& values,
+                                                     size_t k) const {
+        std::vector<CoefficientType> coefficients;
+        for (const Monom& m : g.get_monomials_ascending_order()) {
+            CoefficientType value = m.get_coefficient();
+            size_t degree = 0;
+            for (const auto& [var, deg] : m.get_variables_ascending_order()) {
+                size_t index = get_variable_index(var);
+                if (index == k) {
+                    degree = deg;
+                } else {
+                    value *= pow(values[index], deg);
+                }
+            }
+            if (coefficients.size() <= degree) { coefficients.resize(degree + 1, CoefficientType(0)); }
+            coefficients[degree] += value;
+        }
+        return UnivariatePolynomial<CoefficientType>(std::move(coefficients));
+    }
+
+    //FGLM: walks monomials in increasing Lex order, representing each in the quotient ring.
+    //Linearly dependent monomial gives new element of the Lex basis, independent one is a new standard monomial.
+    void convert_to_lex() {
+        using Element = typename QuotientRing<Polynom>::Element;
+        struct Candidate {
+            size_t parent;
+            size_t variable_index;
+        };
+        struct Row {
+            size_t pivot;
+            Element reduced;
+            Element combination;
+        };
+        const auto& variables = ring_.get_variables();
+        if (ring_.dimension() == 0) {
+            lex_basis_.push_back(LexPolynom("1"));
+            return;
+        }
+        std::map<Monom, Candidate, MonomialOrders::Lex> candidates = {{Monom("1"), {SIZE_MAX, 0}}};
+        std::vector<Monom> staircase;
+        std::vector<Element> staircase_elements;
+        std::vector<Row> rows;
+        while (!candidates.empty()) {
+            auto node = candidates.extract(candidates.begin());
+            const Monom& monomial = node.key();
+            const Candidate& candidate = node.mapped();
+            bool is_reducible = false;
+            for (const LexPolynom& g : lex_basis_) {
+                is_reducible |= monomial.is_divisible_on(g.get_highest_monomial());
+            }
+            if (is_reducible) { continue; }
+            Element element = candidate.parent == SIZE_MAX
+                                      ? ring_.one()
+                                      : ring_.multiply_by_variable(staircase_elements[candidate.parent],
+                                                                   candidate.variable_index);
+            Element reduced = element;
+            Element combination(staircase.size(), CoefficientType(0));
+            for (const Row& row : rows) {
+                CoefficientType factor = reduced[row.pivot];
+                if (factor == 0) { continue; }
+                for (size_t i = 0; i < reduced.size(); ++i) { reduced[i] -= factor * row.reduced[i]; }
+                for (size_t i = 0; i < row.combination.size(); ++i) {
+                    combination[i] += factor * row.combination[i];
+                }
+            }
+            size_t pivot = std::find_if(reduced.begin(), reduced.end(), [](const auto& c) { return c != 0; }) -
+                           reduced.begin();
+            if (pivot == reduced.size()) {
+                //element = sum combination_j * staircase_j
+                LexPolynom g(monomial);
+                for (size_t j = 0; j < staircase.size(); ++j) {
+                    if (combination[j] != 0) { g -= LexPolynom(staircase[j] * combination[j]); }
+                }
+                lex_basis_.push_back(std::move(g));
+                continue;
+            }
+            //reduced = element - sum combination_j * staircase_j, so the new row is expressed via staircase
+            CoefficientType inverse_pivot = invert(reduced[pivot]);
+            for (auto& c : reduced) { c *= inverse_pivot; }
+            for (auto& c : combination) { c = -c * inverse_pivot; }
+            combination.push_back(inverse_pivot);
+            rows.push_back({pivot, std::move(reduced), std::move(combination)});
+            staircase.push_back(monomial);
+            staircase_elements.push_back(std::move(element));
+            for (size_t v = 0; v < variables.size(); ++v) {
+                Monom next = monomial * Monom(CoefficientType(1), variables[v], 1);
+                if (!candidates.count(next)) { candidates.emplace(next, Candidate{staircase.size() - 1, v}); }
+            }
+        }
+    }
+
+    QuotientRing<Polynom> ring_;
+    std::vector<LexPolynom> lex_basis_;
+};
@@ -1,8 +1,14 @@
 #pragma once
 #include <algorithm>
+#include <concepts>
 #include <iostream>
 
 namespace MonomialOrders {
+    //Monomials with packed exponents can compare themselves in the order's own encoding
+    template<typename T, typename Order>
+    concept PackedComparable = requires(const T& m1, const T& m2, Order order) {
+        { m1.is_less(m2, order) } -> std::convertible_to<bool>;
+    };
 
     template<class InputIt1, class InputIt2, class Compare>
     bool lexicographical_compare(InputIt1 first1, InputIt1 last1, InputIt2 first2, InputIt2 last2, Compare comp) {
@@ -25,6 +31,7 @@ namespace MonomialOrders {
     struct Lex {
         template<typename T>
         bool operator()(const T& m1, const T& m2) const {
+            if constexpr (PackedComparable<T, Lex>) { return m1.is_less(m2, *this); }
             auto v1 = m1.get_variables_descending_order();
             auto v2 = m2.get_variables_descending_order();
             return lexicographical_compare(v1.begin(), v1.end(), v2.begin(), v2.end());
@@ -34,6 +41,7 @@ namespace MonomialOrders {
     struct Grlex {
         template<typename T>
         bool operator()(const T& m1, const T& m2) const {
+            if constexpr (PackedComparable<T, Grlex>) { return m1.is_less(m2, *this); }
             auto deg1 = m1.get_degree();
             auto deg2 = m2.get_degree();
             if (deg1 != deg2) { return deg1 < deg2; }
@@ -45,6 +53,7 @@ namespace MonomialOrders {
     struct Grevlex {
         template<typename T>
         bool operator()(const T& m1, const T& m2) const {
+            if constexpr (PackedComparable<T, Grevlex>) { return m1.is_less(m2, *this); }
             auto deg1 = m1.get_degree();
             auto deg2 = m2.get_degree();
             if (deg1 != deg2) { return deg1 < deg2; }
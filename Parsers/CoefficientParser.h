@@ -1,19 +1,54 @@
 #pragma once
 #include "../Fields/Fraction.h"
+#include "../Fields/GF2.h"
+#include "../Fields/Integer.h"
 #include "../Fields/Mint.h"
+#include "../Fields/RuntimeMint.h"
+#include <cctype>
+#include <string_view>
 
+//Parsers read from *pos and advance it past the consumed characters.
+//They return nullptr on success or error message, then *pos points to the bad character.
 namespace num_reader {
-    template<typename U>
-    size_t read_num(const std::string& s, U& var, size_t pos) {
-        int32_t sgn = 1;
-        if (s[pos] == '-' || s[pos] == '+') {
-            if (s[pos] == '-') sgn = -1;
-            ++pos;
+    //<cctype> functions are undefined for negative char values, which bytes of UTF-8 input are
+    inline bool is_digit(char c) { return std::isdigit(static_cast<unsigned char>(c)); }
+
+    inline bool is_letter(char c) { return std::isalpha(static_cast<unsigned char>(c)); }
+
+    inline void skip_spaces(std::string_view s, size_t* pos) {
+        while (*pos < s.size() && (s[*pos] == ' ' || s[*pos] == '\t' || s[*pos] == '\r')) { ++*pos; }
+    }
+
+    inline int32_t read_sign(std::string_view s, size_t* pos) {
+        int32_t sign = 1;
+        if (*pos < s.size() && (s[*pos] == '-' || s[*pos] == '+')) {
+            if (s[*pos] == '-') sign = -1;
+            ++*pos;
+            skip_spaces(s, pos);
         }
-        assert(std::isdigit(s[pos]) && "Expected digit");
-        for (; pos < s.size() && isdigit(s[pos]); ++pos) { var = var * 10 + s[pos] - '0'; }
-        var *= sgn;
-        return pos;
+        return sign;
+    }
+
+    template<typename U>
+    const char* read_digits(std::string_view s, size_t* pos, U* value) {
+        if (*pos == s.size() || !is_digit(s[*pos])) { return "Expected digit"; }
+        *value = 0;
+        for (; *pos < s.size() && is_digit(s[*pos]); ++*pos) { *value = *value * 10 + (s[*pos] - '0'); }
+        return nullptr;
+    }
+
+    template<typename U>
+    const char* read_num(std::string_view s, size_t* pos, U* value) {
+        int32_t sign = read_sign(s, pos);
+        if (const char* error = read_digits(s, pos, value)) { return error; }
+        *value *= sign;
+        return nullptr;
+    }
+
+    inline const char* expect(std::string_view s, size_t* pos, std::string_view token, const char* error) {
+        if (s.substr(*pos, token.size()) != token) { return error; }
+        *pos += token.size();
+        return nullptr;
     }
 }// namespace num_reader
 
@@ -22,51 +57,83 @@ struct CoefficientParser {
     CoefficientParser() { assert(0 && "This CoefficientType is not supported!"); }
 };
 
+//Coefficient is an optional sign followed by an optional integer or \frac{numerator}{denominator}
 template<typename T>
 struct CoefficientParser<Fraction<T>> {
-    Fraction<T> parse(std::string& s) {
-        size_t l = 0;
-        Fraction<T> coefficient = 1;
-        int32_t coefficient_sign = 1;
-        if (s[0] == '-' || s[0] == '+') {
-            coefficient_sign = s[0] == '+' ? 1 : -1;
-            ++l;
+    const char* parse(std::string_view s, size_t* pos, Fraction<T>* coefficient) const {
+        int32_t sign = num_reader::read_sign(s, pos);
+        T numerator = 1, denominator = 1;
+        if (*pos < s.size() && num_reader::is_digit(s[*pos])) {
+            num_reader::read_digits(s, pos, &numerator);
+        } else if (*pos < s.size() && s[*pos] == '\\') {
+            constexpr const char* kBadFraction = "Expected fraction in form \\frac{numerator}{denominator}";
+            if (const char* error = num_reader::expect(s, pos, "\\frac{", kBadFraction)) { return error; }
+            if (const char* error = num_reader::read_num(s, pos, &numerator)) { return error; }
+            if (const char* error = num_reader::expect(s, pos, "}{", kBadFraction)) { return error; }
+            size_t denominator_pos = *pos;
+            if (const char* error = num_reader::read_num(s, pos, &denominator)) { return error; }
+            if (const char* error = num_reader::expect(s, pos, "}", kBadFraction)) { return error; }
+            if (denominator == 0) {
+                *pos = denominator_pos;
+                return "Fraction can't have a zero denominator";
+            }
         }
-        assert(l != s.size() && "Bad monomial");
-        if (isdigit(s[l])) {
-            coefficient = 0;
-            l = num_reader::read_num(s, coefficient, l);
-        } else if (s[l] == '\\') {
-            assert(s.substr(l, 6) == "\\frac{" && "Expected fraction in form \\frac{numerator}{denominator}");
-            int64_t numerator = 0, denominator = 0;
-            size_t l1 = num_reader::read_num(s, numerator, l + 6);
-            l = num_reader::read_num(s, denominator, l1 + 2) + 1;
-            coefficient = Fraction(numerator, denominator);
-        }
-        s = s.substr(l);
-        coefficient *= coefficient_sign;
-        return coefficient;
+        *coefficient = Fraction<T>(numerator * sign, denominator);
+        return nullptr;
     }
 };
 
+//Coefficient is an optional sign followed by an optional integer, which is reduced modulo MOD digit by digit
 template<typename T, const T MOD>
 struct CoefficientParser<Mint<T, MOD>> {
-    Mint<T, MOD> parse(std::string& s) {
-        size_t l = 0;
-        Mint<T, MOD> coefficient = 1;
-        coefficient = 1;
-        int32_t coefficient_sign = 1;
-        if (s[0] == '-' || s[0] == '+') {
-            coefficient_sign = s[0] == '+' ? 1 : -1;
-            ++l;
+    const char* parse(std::string_view s, size_t* pos, Mint<T, MOD>* coefficient) const {
+        int32_t sign = num_reader::read_sign(s, pos);
+        *coefficient = 1;
+        if (*pos < s.size() && num_reader::is_digit(s[*pos])) { num_reader::read_digits(s, pos, coefficient); }
+        *coefficient *= sign;
+        return nullptr;
+    }
+};
+
+//Same as for Mint, the modulus must be set before parsing
+template<typename T>
+struct CoefficientParser<RuntimeMint<T>> {
+    const char* parse(std::string_view s, size_t* pos, RuntimeMint<T>* coefficient) const {
+        int32_t sign = num_reader::read_sign(s, pos);
+        *coefficient = 1;
+        if (*pos < s.size() && num_reader::is_digit(s[*pos])) { num_reader::read_digits(s, pos, coefficient); }
+        *coefficient *= sign;
+        return nullptr;
+    }
+};
+
+//Coefficient is an optional sign followed by an optional integer, only its parity matters
+template<>
+struct CoefficientParser<GF2> {
+    const char* parse(std::string_view s, size_t* pos, GF2* coefficient) const {
+        num_reader::read_sign(s, pos);
+        *coefficient = 1;
+        if (*pos < s.size() && num_reader::is_digit(s[*pos])) {
+            int32_t last_digit = 0;
+            for (; *pos < s.size() && num_reader::is_digit(s[*pos]); ++*pos) { last_digit = s[*pos] - '0'; }
+            *coefficient = last_digit;
         }
-        assert(l != s.size() && "Bad monomial");
-        if (isdigit(s[l])) {
-            coefficient = 0;
-            l = num_reader::read_num(s, coefficient, l);
+        return nullptr;
+    }
+};
+
+//Coefficient is an optional sign followed by an optional integer
+template<typename T>
+struct CoefficientParser<Integer<T>> {
+    const char* parse(std::string_view s, size_t* pos, Integer<T>* coefficient) const {
+        int32_t sign = num_reader::read_sign(s, pos);
+        T value = 1;
+        if (*pos < s.size() && num_reader::is_digit(s[*pos])) {
+            num_reader::read_digits(s, pos, &value);
+        } else if (*pos < s.size() && s[*pos] == '\\') {
+            return "Integer coefficient can't be a fraction";
         }
-        s = s.substr(l);
-        coefficient *= coefficient_sign;
-        return coefficient;
+        *coefficient = value * sign;
+        return nullptr;
     }
 };
@@ -0,0 +1,69 @@
+#pragma once
+#include <string>
+#include <string_view>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <fstream>
+#include <sstream>
+#endif
+
+//Read-only view of a whole file, memory-mapped where the platform allows it
+class MappedFile {
+public:
+    explicit MappedFile(const std::string& path) {
+#if defined(__unix__) || defined(__APPLE__)
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) { return; }
+        struct stat st {};
+        if (::fstat(fd, &st) == 0) {
+            is_open_ = true;
+            size_ = static_cast<size_t>(st.st_size);
+            if (size_ > 0) {
+                void* data = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+                if (data == MAP_FAILED) {
+                    is_open_ = false;
+                } else {
+                    data_ = static_cast<const char*>(data);
+                    ::madvise(data, size_, MADV_SEQUENTIAL);
+                }
+            }
+        }
+        ::close(fd);
+#else
+        std::ifstream in(path, std::ios::binary);
+        if (!in) { return; }
+        std::ostringstream content;
+        content << in.rdbuf();
+        buffer_ = std::move(content).str();
+        is_open_ = true;
+        data_ = buffer_.data();
+        size_ = buffer_.size();
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    ~MappedFile() {
+#if defined(__unix__) || defined(__APPLE__)
+        if (data_) { ::munmap(const_cast<char*>(data_), size_); }
+#endif
+    }
+
+    bool is_open() const { return is_open_; }
+
+    std::string_view get_view() const { return data_ ? std::string_view(data_, size_) : std::string_view(); }
+
+private:
+    bool is_open_ = false;
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+#if !defined(__unix__) && !defined(__APPLE__)
+    std::string buffer_;
+#endif
+};
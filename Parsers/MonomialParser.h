@@ -2,6 +2,8 @@
 #include "../Library/Variable.h"
 #include "CoefficientParser.h"
 #include <map>
+#include <memory_resource>
+#include <string>
 
 template<typename CoefficientType, typename VariableOrder = VariableOrders::AsciiOrder, typename DegreeType = int64_t,
          typename VariableNumberType = int32_t>
@@ -9,32 +11,49 @@ class MonomialParser {
     using Var = Variable<VariableNumberType, VariableOrder>;
 
 public:
-    void parse(std::string& s, CoefficientType* coefficient, std::map<Var, DegreeType>* var_store) {
+    void parse(const std::string& s, CoefficientType* coefficient, std::pmr::map<Var, DegreeType>* var_store) {
         if (s.empty()) { return; }
-        *coefficient = CoefficientParser<CoefficientType>().parse(s);
-        parse_variables(s, var_store);
+        size_t pos = 0;
+        [[maybe_unused]] const char* error = parse(s, &pos, coefficient, var_store);
+        assert(error == nullptr && "Bad monomial");
+        assert(pos == s.size() && "Unexpected character in monomial");
+    }
+
+    //Reads sign, coefficient and variables starting at *pos, stops at the first character that can't continue them.
+    //Returns nullptr on success or error message, then *pos points to the bad character
+    const char* parse(std::string_view s, size_t* pos, CoefficientType* coefficient,
+                      std::pmr::map<Var, DegreeType>* var_store) {
+        num_reader::skip_spaces(s, pos);
+        size_t start = *pos;
+        if (const char* error = CoefficientParser<CoefficientType>().parse(s, pos, coefficient)) { return error; }
+        //Sign alone is not a coefficient, while integers end with a digit and fractions end with a brace
+        bool has_coefficient = *pos > start && (num_reader::is_digit(s[*pos - 1]) || s[*pos - 1] == '}');
+        if (const char* error = parse_variables(s, pos, var_store)) { return error; }
+        if (!has_coefficient && var_store->empty()) { return "Expected coefficient or variable"; }
+        return nullptr;
     }
 
 private:
-    void parse_variables(const std::string& s, std::map<Var, DegreeType>* var_store) {
-        size_t l = 0;
-        while (l < s.size()) {
-            size_t r = l;
-            char var_name = s[l];
+    const char* parse_variables(std::string_view s, size_t* pos, std::pmr::map<Var, DegreeType>* var_store) {
+        for (num_reader::skip_spaces(s, pos); *pos < s.size() && num_reader::is_letter(s[*pos]);
+             num_reader::skip_spaces(s, pos)) {
+            char var_name = s[(*pos)++];
             VariableNumberType num = -1;
-            if (r + 1 < s.size() && s[r + 1] == '_') {
-                num = 0;
-                r = num_reader::read_num(s, num, r + 2) - 1;
+            num_reader::skip_spaces(s, pos);
+            if (*pos < s.size() && s[*pos] == '_') {
+                ++*pos;
+                num_reader::skip_spaces(s, pos);
+                if (const char* error = num_reader::read_digits(s, pos, &num)) { return error; }
+                num_reader::skip_spaces(s, pos);
             }
             DegreeType var_degree = 1;
-            if (r + 1 < s.size() && s[r + 1] == '^') {
-                var_degree = 0;
-                r = num_reader::read_num(s, var_degree, r + 2) - 1;
+            if (*pos < s.size() && s[*pos] == '^') {
+                ++*pos;
+                num_reader::skip_spaces(s, pos);
+                if (const char* error = num_reader::read_digits(s, pos, &var_degree)) { return error; }
             }
-            Var var{var_name, num};
-            if (!(*var_store).count(var)) { (*var_store)[var] = 0; }
-            (*var_store)[var] += var_degree;
-            l = r + 1;
+            (*var_store)[Var{var_name, num}] += var_degree;
         }
+        return nullptr;
     }
 };
@@ -0,0 +1,57 @@
+#pragma once
+#include "../Library/Ideal.h"
+#include "MappedFile.h"
+#include <optional>
+#include <string_view>
+
+struct ParseError {
+    //Both are 1-based, line 0 means that input couldn't be read at all
+    size_t line;
+    size_t column;
+    std::string message;
+
+    friend std::ostream& operator<<(std::ostream& os, const ParseError& error) {
+        return os << error.line << ":" << error.column << ": " << error.message;
+    }
+};
+
+//Single-pass reader of polynomial systems: one polynomial per line, blank lines are skipped.
+//Terms are parsed straight from the input without copying it, errors are reported with their positions.
+template<typename Polynom>
+class SystemParser {
+public:
+    std::optional<ParseError> parse(std::string_view text, std::vector<Polynom>* polynomials) const {
+        size_t line = 1;
+        for (size_t pos = 0; pos < text.size(); ++line) {
+            size_t line_start = pos;
+            Polynom p;
+            const char* error = Polynom::parse(text, &pos, &p);
+            if (!error && pos < text.size() && text[pos] != '\n') { error = "Unexpected character"; }
+            if (error) { return ParseError{line, pos - line_start + 1, error}; }
+            if (!p.is_zero() || !is_blank(text.substr(line_start, pos - line_start))) {
+                polynomials->push_back(std::move(p));
+            }
+            ++pos;
+        }
+        return std::nullopt;
+    }
+
+    std::optional<ParseError> parse(std::string_view text, Ideal<Polynom>* ideal) const {
+        std::vector<Polynom> polynomials;
+        if (auto error = parse(text, &polynomials)) { return error; }
+        for (auto& p : polynomials) { ideal->insert(std::move(p)); }
+        return std::nullopt;
+    }
+
+    template<typename Output>
+    std::optional<ParseError> parse_file(const std::string& path, Output* output) const {
+        MappedFile file(path);
+        if (!file.is_open()) { return ParseError{0, 0, "Can't read file " + path}; }
+        return parse(file.get_view(), output);
+    }
+
+private:
+    static bool is_blank(std::string_view s) {
+        return std::all_of(s.begin(), s.end(), [](char c) { return std::isspace(static_cast<unsigned char>(c)); });
+    }
+};
@@ -0,0 +1,98 @@
+#include "../Library/Checkpoint.h"
+#include <sstream>
+using namespace std;
+
+using F = Fraction<int64_t>;
+using MF = Monomial<F, VariableOrders::InverseAsciiOrder>;
+using PMFG = Polynomial<MF, MonomialOrders::Grlex>;
+using M = Mint<int64_t, 998244353>;
+using MM = Monomial<M, VariableOrders::InverseAsciiOrder>;
+using PMMR = Polynomial<MM, MonomialOrders::Grevlex>;
+
+namespace {
+    Ideal<PMMR> cyclic4() { return {"a + b + c + d", "ab + bc + cd + da", "abc + bcd + cda + dab", "abcd - 1"}; }
+
+    void resume_test() {
+        Ideal<PMMR> expected = cyclic4();
+        expected.make_groebner_basis();
+        auto expected_statistics = expected.get_buchberger_state().statistics;
+        assert(expected_statistics.processed_pairs > 20);
+        //Every saved state resumes to exactly the same basis and statistics
+        vector<string> checkpoints;
+        Ideal<PMMR> ideal = cyclic4();
+        ideal.set_checkpoint_handler(
+                [&](const Ideal<PMMR>& ideal) {
+                    stringstream stream;
+                    checkpoint::write(stream, ideal);
+                    checkpoints.push_back(stream.str());
+                },
+                {7, {}});
+        ideal.make_groebner_basis();
+        assert(ideal.get_basis() == expected.get_basis());
+        assert(checkpoints.size() == (expected_statistics.processed_pairs - 1) / 7);
+        for (const string& data : checkpoints) {
+            stringstream stream(data);
+            Ideal<PMMR> resumed;
+            assert(checkpoint::read(stream, &resumed) == nullptr);
+            assert(resumed.get_basis_type() == BasisType::Any);
+            assert(resumed.get_buchberger_state().statistics.processed_pairs % 7 == 0);
+            resumed.make_groebner_basis();
+            assert(resumed.get_basis() == expected.get_basis());
+            auto statistics = resumed.get_buchberger_state().statistics;
+            assert(statistics.processed_pairs == expected_statistics.processed_pairs);
+            assert(statistics.coprime_pairs == expected_statistics.coprime_pairs);
+            assert(statistics.zero_reductions == expected_statistics.zero_reductions);
+        }
+    }
+
+    void file_test() {
+        string path = "checkpoint_test.bin";
+        Ideal<PMFG> expected = {"x^3 - 2xy", "x^2y - 2y^2 + x", "xz - y^2"};
+        Ideal<PMFG> ideal = expected;
+        expected.make_reduced_groebner_basis();
+        checkpoint::enable(&ideal, path, {1, {}}, [](const char*) { assert(false); });
+        ideal.make_groebner_basis();
+        Ideal<PMFG> resumed;
+        assert(checkpoint::load(path, &resumed) == nullptr);
+        assert(resumed.get_buchberger_state().next_i > 0);
+        resumed.make_reduced_groebner_basis();
+        assert(resumed.get_basis() == expected.get_basis());
+        remove(path.c_str());
+        assert(checkpoint::load(path, &resumed) != nullptr);
+    }
+
+    //Computation is stopped from the error callback once the checkpoint can't be saved
+    void save_error_test() {
+        Ideal<PMMR> ideal = cyclic4();
+        stop_source stop;
+        ideal.set_stop_token(stop.get_token());
+        vector<string> errors;
+        checkpoint::enable(&ideal, "missing_directory/checkpoint_test.bin", {2, {}}, [&](const char* error) {
+            errors.push_back(error);
+            stop.request_stop();
+        });
+        assert(ideal.make_groebner_basis() == ComputationStatus::Cancelled);
+        assert(errors == vector<string>{"Can't create file"});
+        assert(ideal.get_buchberger_state().statistics.processed_pairs == 2);
+    }
+
+    void unreached_limits_test() {
+        Ideal<PMMR> ideal = cyclic4();
+        size_t calls = 0;
+        ideal.set_checkpoint_handler([&](const Ideal<PMMR>&) { ++calls; }, {0, chrono::milliseconds(0)});
+        ideal.make_groebner_basis();
+        assert(calls == 0);
+        ideal = cyclic4();
+        ideal.set_checkpoint_handler([&](const Ideal<PMMR>&) { ++calls; }, {0, chrono::milliseconds(1000000)});
+        ideal.make_groebner_basis();
+        assert(calls == 0);
+    }
+}// namespace
+
+int main() {
+    resume_test();
+    file_test();
+    save_error_test();
+    unreached_limits_test();
+    cout << "OK" << endl;
+}
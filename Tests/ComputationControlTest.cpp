@@ -0,0 +1,88 @@
+#include "../Library/Ideal.h"
+using namespace std;
+
+using M = Mint<int64_t, 998244353>;
+using MM = Monomial<M, VariableOrders::InverseAsciiOrder>;
+using PMMR = Polynomial<MM, MonomialOrders::Grevlex>;
+using M2 = Monomial<Mint<int64_t, 2>, VariableOrders::InverseAsciiOrder>;
+using PM2L = Polynomial<M2, MonomialOrders::Lex>;
+
+namespace {
+    Ideal<PMMR> cyclic4() { return {"a + b + c + d", "ab + bc + cd + da", "abc + bcd + cda + dab", "abcd - 1"}; }
+
+    //Computation of Killer.cpp, which doesn't finish in reasonable time
+    Ideal<PM2L> endless() { return {"x^5 + y^4 + z^3 - 1", "x^3 + y^3 + z^2 - 1"}; }
+
+    void progress_test() {
+        Ideal<PMMR> ideal = cyclic4();
+        vector<Ideal<PMMR>::Progress> reports;
+        ideal.set_progress_handler([&](const auto& progress) { reports.push_back(progress); }, 3);
+        assert(ideal.make_groebner_basis() == ComputationStatus::Completed);
+        uint64_t processed_pairs = ideal.get_buchberger_state().statistics.processed_pairs;
+        assert(reports.size() == (processed_pairs + 2) / 3);
+        for (size_t i = 0; i < reports.size(); ++i) {
+            const auto& [basis_size, pending_pairs, current_degree, processed, elapsed] = reports[i];
+            assert(processed == 3 * i);
+            assert(basis_size >= 4 && basis_size <= ideal.size());
+            assert(pending_pairs > 0 && pending_pairs <= basis_size * (basis_size - 1) / 2);
+            assert(current_degree >= 2);
+            if (i) { assert(basis_size >= reports[i - 1].basis_size && elapsed >= reports[i - 1].elapsed); }
+        }
+        assert(reports[0].basis_size == 4 && reports[0].pending_pairs == 6);
+    }
+
+    void cancellation_test() {
+        Ideal<PMMR> expected = cyclic4();
+        expected.make_reduced_groebner_basis();
+        Ideal<PMMR> ideal = cyclic4();
+        stop_source stop;
+        ideal.set_stop_token(stop.get_token());
+        ideal.set_progress_handler([&](const auto& progress) {
+            if (progress.processed_pairs == 10) { stop.request_stop(); }
+        });
+        assert(ideal.make_reduced_groebner_basis() == ComputationStatus::Cancelled);
+        assert(ideal.get_basis_type() == BasisType::Any);
+        assert(ideal.get_buchberger_state().statistics.processed_pairs == 10);
+        assert(ideal.size() > 4);
+        //Partial basis is still a subset of the ideal
+        for (const auto& p : ideal.get_basis()) { assert(expected.contains(p)); }
+        assert(ideal.make_reduced_groebner_basis() == ComputationStatus::Cancelled);
+        ideal.set_stop_token({});
+        assert(ideal.make_reduced_groebner_basis() == ComputationStatus::Completed);
+        assert(ideal.get_basis() == expected.get_basis());
+    }
+
+    void time_limit_test() {
+        Ideal<PM2L> ideal = endless();
+        ideal.set_computation_limits({chrono::milliseconds(200), 0});
+        auto start = chrono::steady_clock::now();
+        assert(ideal.make_groebner_basis() == ComputationStatus::TimeLimitExceeded);
+        assert(chrono::steady_clock::now() - start < chrono::seconds(60));
+        assert(ideal.get_basis_type() == BasisType::Any);
+        size_t size = ideal.size();
+        assert(size > 2);
+        //Limit is per call, so the computation goes further
+        assert(ideal.make_groebner_basis() == ComputationStatus::TimeLimitExceeded);
+        assert(ideal.size() >= size);
+    }
+
+    void memory_limit_test() {
+        Ideal<PM2L> ideal = endless();
+        ideal.set_computation_limits({{}, 1 << 22});
+        assert(ideal.make_minimal_groebner_basis() == ComputationStatus::MemoryLimitExceeded);
+        assert(ideal.get_basis_type() == BasisType::Any && ideal.size() > 2);
+        //Partial basis survives the arena
+        for (const auto& p : ideal.get_basis()) { assert(!p.is_zero()); }
+        Ideal<PMMR> small = cyclic4();
+        small.set_computation_limits({{}, 1 << 22});
+        assert(small.make_reduced_groebner_basis() == ComputationStatus::Completed);
+    }
+}// namespace
+
+int main() {
+    progress_test();
+    cancellation_test();
+    time_limit_test();
+    memory_limit_test();
+    cout << "OK" << endl;
+}
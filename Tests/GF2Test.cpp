@@ -0,0 +1,123 @@
+#include "../Library/GF2Groebner.h"
+#include <random>
+using namespace std;
+
+using MG = Monomial<GF2, VariableOrders::InverseAsciiOrder>;
+using PGL = Polynomial<MG, MonomialOrders::Lex>;
+using PGR = Polynomial<MG, MonomialOrders::Grevlex>;
+
+namespace {
+    void field_test() {
+        GF2 one = 1, zero = 0;
+        assert(one + one == zero && one - one == zero && -one == one);
+        assert(one * one == one && one * zero == zero && one / one == one);
+        assert(GF2(-3) == one && GF2(int64_t(4)) == zero);
+        assert(PGR("3x + 2y + 5") == PGR("x + 1"));
+        assert(PGR("x + y") + PGR("y + z") == PGR("x + z"));
+        assert(PGR("x + 1") * PGR("x + 1") == PGR("x^2 + 1"));
+    }
+
+    //Textbook elimination for comparison
+    vector<vector<bool>> naive_echelon_form(vector<vector<bool>> a) {
+        size_t rank = 0;
+        for (size_t c = 0; c < (a.empty() ? 0 : a[0].size()) && rank < a.size(); ++c) {
+            size_t p = rank;
+            while (p < a.size() && !a[p][c]) { ++p; }
+            if (p == a.size()) { continue; }
+            swap(a[p], a[rank]);
+            for (size_t i = 0; i < a.size(); ++i) {
+                if (i != rank && a[i][c]) {
+                    for (size_t j = 0; j < a[i].size(); ++j) { a[i][j] = a[i][j] != a[rank][j]; }
+                }
+            }
+            ++rank;
+        }
+        return a;
+    }
+
+    void matrix_test() {
+        mt19937 rng(777);
+        for (auto [rows, columns, density] : {tuple{5, 7, 0.5}, {40, 30, 0.1}, {100, 200, 0.5}, {200, 70, 0.02},
+                                             {64, 64, 0.9}, {130, 300, 0.05}, {1, 1, 1.0}, {300, 129, 0.3}}) {
+            bernoulli_distribution bit(density);
+            vector<vector<bool>> a(rows, vector<bool>(columns));
+            GF2Matrix matrix(rows, columns);
+            for (int i = 0; i < rows; ++i) {
+                for (int j = 0; j < columns; ++j) {
+                    if (bit(rng)) {
+                        a[i][j] = true;
+                        matrix.flip(i, j);
+                    }
+                }
+            }
+            //Dependent rows
+            for (int i = 0; i + 2 < rows; i += 3) {
+                for (int j = 0; j < columns; ++j) {
+                    if (a[i][j] != a[i + 1][j]) { matrix.flip(i + 2, j); }
+                    a[i + 2][j] = a[i + 2][j] != (a[i][j] != a[i + 1][j]);
+                }
+            }
+            auto expected = naive_echelon_form(a);
+            size_t rank = matrix.echelonize();
+            for (int i = 0; i < rows; ++i) {
+                bool nonzero = false;
+                for (int j = 0; j < columns; ++j) {
+                    assert(matrix.get(i, j) == expected[i][j]);
+                    nonzero |= expected[i][j];
+                }
+                assert(nonzero == (size_t(i) < rank));
+            }
+        }
+    }
+
+    template<typename Polynom>
+    void compare_with_buchberger(const initializer_list<string>& generators, gf2::Options options = {}) {
+        Ideal<Polynom> expected(generators);
+        if (options.boolean_ring) {
+            for (char v : {'x', 'y', 'z', 'w'}) { expected.insert(string(1, v) + "^2 + " + v); }
+        }
+        expected.make_reduced_groebner_basis();
+        Ideal<Polynom> ideal(generators);
+        gf2::make_groebner_basis(&ideal, options);
+        assert(ideal.get_basis_type() == BasisType::Groebner);
+        ideal.make_reduced_groebner_basis();
+        //Reduced basis is unique up to order of polynomials
+        assert(ideal.size() == expected.size());
+        for (const auto& p : expected.get_basis()) { assert(ideal.basis_contains(p)); }
+    }
+
+    void groebner_test() {
+        compare_with_buchberger<PGR>({"x^2 + y", "xy + 1"});
+        compare_with_buchberger<PGR>({"xyz + x + 1", "x^2y + z^2 + y", "yz^2 + xz + x"});
+        compare_with_buchberger<PGL>({"x^3 + y^2 + xz", "xy^2 + z + 1", "y^3 + x"});
+        compare_with_buchberger<PGR>({"xy + z + 1", "yz + x", "xz + y + w", "xyzw + 1"}, {true});
+        compare_with_buchberger<PGL>({"xy + z", "yz + w + 1", "xw + y"}, {true});
+        //Inconsistent Boolean system
+        Ideal<PGR> ideal = {"x + y + 1", "xy + 1"};
+        gf2::make_groebner_basis(&ideal, {true});
+        ideal.make_reduced_groebner_basis();
+        assert(ideal.is_basis_equals_to({"1"}));
+    }
+
+    //System of Killer.cpp, which Buchberger's algorithm doesn't finish in reasonable time
+    void killer_test() {
+        Ideal<PGL> ideal = {"x^5 + y^4 + z^3 - 1", "x^3 + y^3 + z^2 - 1"};
+        gf2::make_groebner_basis(&ideal);
+        ideal.make_reduced_groebner_basis();
+        assert(ideal.size() == 9);
+        assert(ideal.contains(PGL("x^5 + y^4 + z^3 - 1")) && ideal.contains(PGL("x^3 + y^3 + z^2 - 1")));
+        //Buchberger's criterion
+        const auto& basis = ideal.get_basis();
+        for (size_t i = 0; i < basis.size(); ++i) {
+            for (size_t j = 0; j < i; ++j) { assert(ideal.contains(get_S_polynomial(basis[i], basis[j]))); }
+        }
+    }
+}// namespace
+
+int main() {
+    field_test();
+    matrix_test();
+    groebner_test();
+    killer_test();
+    cout << "OK" << endl;
+}
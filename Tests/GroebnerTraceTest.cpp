@@ -0,0 +1,107 @@
+#include "../Library/GroebnerTrace.h"
+#include "TestUtilities.h"
+#include <random>
+using namespace std;
+using namespace tests;
+
+using M = Mint<int64_t, 998244353>;
+using MM = Monomial<M, VariableOrders::InverseAsciiOrder>;
+using PR = Polynomial<MM, MonomialOrders::Grevlex>;
+using PL = Polynomial<MM, MonomialOrders::Lex>;
+using R = RuntimeMint<int64_t>;
+using PM = Polynomial<Monomial<R, VariableOrders::InverseAsciiOrder>, MonomialOrders::Grevlex>;
+
+namespace {
+    //Replaces every coefficient of the generators by a random nonzero one, keeping their supports
+    template<typename Polynom>
+    vector<Polynom> randomize(const vector<string>& generators, mt19937& rng) {
+        using Monom = typename Polynom::Monom_;
+        vector<Polynom> res;
+        for (const auto& s : generators) {
+            Polynom p(s), q;
+            for (const Monom& m : p.get_monomials_ascending_order()) {
+                vector<pair<typename Monom::Variable_, int64_t>> powers;
+                for (const auto& [var, deg] : m.get_variables_ascending_order()) { powers.emplace_back(var, deg); }
+                q.append_highest_monomial({int64_t(rng() % 1000 + 1), powers});
+            }
+            res.push_back(std::move(q));
+        }
+        return res;
+    }
+
+    template<typename Polynom>
+    void check_family(const vector<string>& generators) {
+        mt19937 rng(50);
+        Ideal<Polynom> learning(randomize<Polynom>(generators, rng));
+        Ideal<Polynom> direct = learning;
+        direct.make_reduced_groebner_basis();
+        auto trace = *GroebnerTrace<Polynom>::learn(&learning);
+        assert(learning.get_basis_type() == BasisType::ReducedGroebner && are_same_bases(learning, direct));
+        assert(trace.size() > 0 && trace.get_zero_reductions_count() > 0);
+
+        for (int instance = 0; instance < 5; ++instance) {
+            Ideal<Polynom> ideal(randomize<Polynom>(generators, rng));
+            Ideal<Polynom> expected = ideal;
+            expected.make_reduced_groebner_basis();
+            assert(trace.replay(&ideal, true));
+            assert(ideal.get_basis_type() == BasisType::ReducedGroebner && are_same_bases(ideal, expected));
+        }
+    }
+
+    void family_test() {
+        check_family<PR>(systems::cyclic(4));
+        check_family<PR>(systems::katsura(3));
+        check_family<PL>(systems::cyclic(4));
+    }
+
+    void fallback_test() {
+        mt19937 rng(50);
+        Ideal<PR> learning(randomize<PR>(systems::cyclic(4), rng));
+        auto trace = *GroebnerTrace<PR>::learn(&learning);
+
+        //Different leading monomials
+        Ideal<PR> other = make_ideal<PR>(systems::katsura(3)), expected = make_ideal<PR>(systems::katsura(3));
+        expected.make_reduced_groebner_basis();
+        assert(!trace.replay(&other));
+        assert(are_same_bases(other, expected));
+
+        //Same supports, but special coefficients cancel recorded terms or change leading monomials of remainders
+        other = make_ideal<PR>(systems::cyclic(4)), expected = make_ideal<PR>(systems::cyclic(4));
+        expected.make_reduced_groebner_basis();
+        trace.replay(&other, true);
+        assert(are_same_bases(other, expected));
+
+        //Generators of a computed basis aren't replayed
+        assert(trace.replay(&expected) && expected.get_basis_type() == BasisType::ReducedGroebner);
+    }
+
+    void limits_test() {
+        mt19937 rng(50);
+        Ideal<PR> learning(randomize<PR>(systems::cyclic(4), rng));
+        assert(!GroebnerTrace<PR>::learn(&learning, {chrono::milliseconds(0), 1}));
+        assert(learning.get_basis_type() == BasisType::Any && learning.size() == systems::cyclic(4).size());
+        assert(GroebnerTrace<PR>::learn(&learning, {chrono::milliseconds(0), size_t(1) << 30}));
+        assert(learning.get_basis_type() == BasisType::ReducedGroebner);
+    }
+
+    //The same system modulo different primes with one trace
+    void multi_modular_test() {
+        R::set_modulus(1000000007);
+        Ideal<PM> learning = make_ideal<PM>(systems::katsura(3));
+        auto trace = *GroebnerTrace<PM>::learn(&learning);
+        for (int64_t prime : {998244353, 1000000009, 2147483647}) {
+            R::set_modulus(prime);
+            Ideal<PM> ideal = make_ideal<PM>(systems::katsura(3)), expected = make_ideal<PM>(systems::katsura(3));
+            expected.make_reduced_groebner_basis();
+            assert(trace.replay(&ideal, true) && are_same_bases(ideal, expected));
+        }
+    }
+}// namespace
+
+int main() {
+    family_test();
+    fallback_test();
+    limits_test();
+    multi_modular_test();
+    cout << "OK" << endl;
+}
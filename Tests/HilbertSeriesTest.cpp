@@ -0,0 +1,156 @@
+#include "../Library/Ideal.h"
+#include <random>
+#include <sstream>
+using namespace std;
+
+using M = Mint<int64_t, 998244353>;
+using MM = Monomial<M, VariableOrders::InverseAsciiOrder>;
+using PR = Polynomial<MM, MonomialOrders::Grevlex>;
+using PL = Polynomial<MM, MonomialOrders::Lex>;
+
+namespace {
+    //Counts monomials of the degree that aren't divisible by any generator
+    int64_t count_standard_monomials(const vector<HilbertSeries::Exponents>& generators, size_t n, int64_t degree) {
+        int64_t count = 0;
+        HilbertSeries::Exponents m(n);
+        auto enumerate = [&](auto&& self, size_t i, int64_t left) -> void {
+            if (i + 1 == n) {
+                m[i] = left;
+                bool is_standard = none_of(generators.begin(), generators.end(), [&m](const auto& g) {
+                    for (size_t k = 0; k < g.size(); ++k) {
+                        if (m[k] < g[k]) { return false; }
+                    }
+                    return true;
+                });
+                count += is_standard;
+                return;
+            }
+            for (int64_t e = 0; e <= left; ++e) {
+                m[i] = e;
+                self(self, i + 1, left - e);
+            }
+        };
+        enumerate(enumerate, 0, degree);
+        return count;
+    }
+
+    void monomial_ideal_test() {
+        //Standard monomials 1, x, y, y^2
+        HilbertSeries series({{2, 0}, {1, 1}, {0, 3}}, 2);
+        assert((series.get_numerator() == vector<int64_t>{1, 0, -2, 0, 1}));
+        assert(series.get_dimension() == 0 && series.get_degree() == 4);
+        assert(series.get_hilbert_function(1) == 2 && series.get_hilbert_function(3) == 0);
+        ostringstream os;
+        os << series;
+        assert(os.str() == "(1 + 2t + t^2) / (1 - t)^0");
+        assert(HilbertSeries({}, 3).get_hilbert_function(2) == 6 && HilbertSeries({}, 3).get_dimension() == 3);
+        assert(HilbertSeries({{0, 0}}, 2).get_hilbert_function(0) == 0);
+        //Line x = y = 0 in 3-space
+        HilbertSeries line({{1}, {0, 1}}, 3);
+        assert(line.get_dimension() == 1 && line.get_degree() == 1);
+
+        mt19937 rng(2024);
+        for (int iteration = 0; iteration < 200; ++iteration) {
+            size_t n = 1 + rng() % 4;
+            vector<HilbertSeries::Exponents> generators(rng() % 7);
+            for (auto& g : generators) {
+                g.resize(n);
+                for (auto& e : g) { e = rng() % 4; }
+            }
+            HilbertSeries series(generators, n);
+            for (int64_t d = 0; d <= 10; ++d) {
+                assert(series.get_hilbert_function(d) == count_standard_monomials(generators, n, d));
+            }
+        }
+    }
+
+    void ideal_test() {
+        //Twisted cubic: projective curve of degree 3
+        Ideal<PR> cubic = {"xz - y^2", "xw - yz", "yw - z^2"};
+        cubic.make_groebner_basis();
+        HilbertSeries series = cubic.get_hilbert_series();
+        assert(series.get_variables_count() == 4 && series.get_dimension() == 2 && series.get_degree() == 3);
+        assert((series.get_reduced_numerator() == vector<int64_t>{1, 2}));
+        //Hilbert series doesn't depend on the order
+        Ideal<PL> lex = {"xz - y^2", "xw - yz", "yw - z^2"};
+        lex.make_reduced_groebner_basis();
+        assert(lex.get_hilbert_series() == series);
+        //Two points
+        Ideal<PR> points = {"x^2 - 1", "y - x"};
+        points.make_reduced_groebner_basis();
+        assert(points.get_hilbert_series().get_dimension() == 0 && points.get_hilbert_series().get_degree() == 2);
+    }
+
+    vector<string> homogeneous_cyclic(int n) {
+        vector<string> res;
+        for (int k = 1; k < n; ++k) {
+            string p;
+            for (int i = 0; i < n; ++i) {
+                p += i ? " + " : "";
+                for (int j = 0; j < k; ++j) { p += "x_" + to_string((i + j) % n + 1); }
+            }
+            res.push_back(p);
+        }
+        string product;
+        for (int i = 1; i <= n; ++i) { product += "x_" + to_string(i); }
+        res.push_back(product + " - x_0^" + to_string(n));
+        return res;
+    }
+
+    void check_hilbert_driven(const vector<string>& generators) {
+        Ideal<PR> grevlex;
+        for (const auto& s : generators) { grevlex.insert(s); }
+        grevlex.make_groebner_basis();
+        HilbertSeries series = grevlex.get_hilbert_series();
+
+        Ideal<PL> plain, driven;
+        for (const auto& s : generators) {
+            plain.insert(s);
+            driven.insert(s);
+        }
+        plain.make_reduced_groebner_basis();
+        driven.set_hilbert_series(series);
+        assert(driven.make_reduced_groebner_basis() == ComputationStatus::Completed);
+        assert(driven.size() == plain.size());
+        for (const auto& p : plain.get_basis()) { assert(driven.basis_contains(p)); }
+        assert(driven.get_hilbert_series() == series);
+        const auto& plain_statistics = plain.get_buchberger_state().statistics;
+        const auto& driven_statistics = driven.get_buchberger_state().statistics;
+        assert(driven_statistics.processed_pairs < plain_statistics.processed_pairs);
+        assert(driven_statistics.zero_reductions < plain_statistics.zero_reductions);
+    }
+
+    void hilbert_driven_test() {
+        check_hilbert_driven({"xz - y^2", "xw - yz", "yw - z^2"});
+        check_hilbert_driven(homogeneous_cyclic(4));
+        check_hilbert_driven({"x^2 + y^2 + z^2 - w^2", "xy - zw + w^2", "x^3 - y^2z + w^3"});
+    }
+
+    //Series that can't be used fall back to the computation over all pairs
+    void hilbert_fallback_test() {
+        vector<string> generators = {"xz - y^2", "xw - yz", "yw - z^2"};
+        Ideal<PL> plain;
+        for (const auto& s : generators) { plain.insert(s); }
+        plain.make_reduced_groebner_basis();
+        //Series of the zero ideal exceeds the Hilbert function of the leading monomials of generators
+        Ideal<PL> mismatched;
+        for (const auto& s : generators) { mismatched.insert(s); }
+        mismatched.set_hilbert_series(HilbertSeries({}, 4));
+        assert(mismatched.make_reduced_groebner_basis() == ComputationStatus::Completed);
+        assert(mismatched.get_basis() == plain.get_basis());
+
+        Ideal<PL> non_homogeneous = {"x^2 - y", "xy - 1"}, expected = non_homogeneous;
+        expected.make_reduced_groebner_basis();
+        non_homogeneous.set_hilbert_series(HilbertSeries({{2, 0}, {0, 1}}, 2));
+        assert(non_homogeneous.make_reduced_groebner_basis() == ComputationStatus::Completed);
+        assert(non_homogeneous.get_basis() == expected.get_basis());
+    }
+}// namespace
+
+int main() {
+    monomial_ideal_test();
+    ideal_test();
+    hilbert_driven_test();
+    hilbert_fallback_test();
+    cout << "OK" << endl;
+}
@@ -0,0 +1,100 @@
+#include "TestUtilities.h"
+using namespace std;
+using namespace tests;
+
+using M = Mint<int64_t, 998244353>;
+using MM = Monomial<M, VariableOrders::InverseAsciiOrder>;
+using PR = Polynomial<MM, MonomialOrders::Grevlex>;
+using PL = Polynomial<MM, MonomialOrders::Lex>;
+using Var = MM::Variable_;
+
+namespace {
+    //Smaller than the variables of benchmark systems
+    const Var z('z');
+
+    void polynomial_test() {
+        PR p("a^3 - 2ab + c - 5");
+        PR homogeneous = p.homogenize(z);
+        assert(homogeneous.is_homogeneous() && homogeneous == PR("a^3 - 2abz + cz^2 - 5z^3"));
+        assert(homogeneous.dehomogenize(z) == p);
+        assert(PR("abc").homogenize(z) == PR("abc") && PR().homogenize(z).is_zero());
+        //Cancelling terms after substitution
+        assert(PR("az - a").dehomogenize(z).is_zero());
+    }
+
+    template<typename Polynom>
+    void check_homogenized_computation(const vector<string>& generators, BasisType expected_type) {
+        Ideal<Polynom> direct = make_ideal<Polynom>(generators);
+        direct.make_reduced_groebner_basis();
+
+        Ideal<Polynom> ideal = make_ideal<Polynom>(generators);
+        ideal.homogenize(z);
+        assert(ideal.is_homogeneous());
+        assert(ideal.make_groebner_basis_up_to_degree(INT64_MAX) == ComputationStatus::Completed);
+        assert(ideal.get_basis_type() == BasisType::Groebner);
+        ideal.dehomogenize(z);
+        assert(ideal.get_basis_type() == expected_type);
+        ideal.make_reduced_groebner_basis();
+        assert(are_same_bases(ideal, direct));
+    }
+
+    void homogenization_test() {
+        //Dehomogenized basis in Grevlex with the smallest homogenizing variable is a Groebner basis
+        check_homogenized_computation<PR>(systems::cyclic(4), BasisType::Groebner);
+        check_homogenized_computation<PR>(systems::katsura(3), BasisType::Groebner);
+        check_homogenized_computation<PL>(systems::cyclic(4), BasisType::Any);
+
+        //Homogenizing variable isn't the smallest one
+        Ideal<PR> ideal = {"x^2 - y", "xy - 1"};
+        ideal.homogenize(Var('a'));
+        ideal.make_groebner_basis();
+        ideal.dehomogenize(Var('a'));
+        assert(ideal.get_basis_type() == BasisType::Any);
+    }
+
+    void truncation_test() {
+        Ideal<PR> full = make_ideal<PR>(systems::katsura(3));
+        full.homogenize(z);
+        full.make_reduced_groebner_basis();
+        auto max_degree = max_element(full.get_basis().begin(), full.get_basis().end(), [](const PR& p1, const PR& p2) {
+                              return p1.get_degree() < p2.get_degree();
+                          })->get_degree();
+
+        //Pairs of degree above the basis degree are left, though they reduce to zero
+        bool is_complete = false;
+        for (int64_t d = 1; !is_complete; ++d) {
+            Ideal<PR> truncated = make_ideal<PR>(systems::katsura(3));
+            truncated.homogenize(z);
+            assert(truncated.make_groebner_basis_up_to_degree(d) == ComputationStatus::Completed);
+            //Correct up to degree d: elements of the reduced basis of degree at most d reduce to zero
+            for (const auto& p : full.get_basis()) {
+                if (p.get_degree() <= d) { assert(truncated.is_redusable_to_zero(p)); }
+            }
+            is_complete = truncated.get_basis_type() == BasisType::Groebner;
+            assert(d >= max_degree || !is_complete);
+            //Computation continues past the truncation
+            truncated.make_reduced_groebner_basis();
+            assert(are_same_bases(truncated, full));
+        }
+
+        //The only pair above the bound is coprime, so nothing is left
+        Ideal<PR> coprime = make_ideal<PR>({"x^2 + xz", "y^3"});
+        assert(coprime.make_groebner_basis_up_to_degree(3) == ComputationStatus::Completed);
+        assert(coprime.get_basis_type() == BasisType::Groebner);
+
+        //Degree bound doesn't hold for non-homogeneous generators, the whole basis is computed
+        Ideal<PR> non_homogeneous = make_ideal<PR>(systems::katsura(3)), direct = make_ideal<PR>(systems::katsura(3));
+        assert(non_homogeneous.make_groebner_basis_up_to_degree(1) == ComputationStatus::Completed);
+        assert(non_homogeneous.get_basis_type() == BasisType::Groebner);
+        non_homogeneous.make_reduced_groebner_basis();
+        direct.make_reduced_groebner_basis();
+        assert(are_same_bases(non_homogeneous, direct));
+    }
+}// namespace
+
+int main() {
+    polynomial_test();
+    homogenization_test();
+    truncation_test();
+    cout << "OK" << endl;
+}
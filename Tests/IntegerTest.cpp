@@ -0,0 +1,120 @@
+#include "../Benchmarks/Systems.h"
+#include "../Library/Ideal.h"
+#include <sstream>
+using namespace std;
+
+using I = Integer<int64_t>;
+using F = Fraction<int64_t>;
+using M = Mint<int64_t, 998244353>;
+using MI = Monomial<I, VariableOrders::InverseAsciiOrder>;
+
+namespace {
+    template<typename T>
+    string to_string(const T& value) {
+        ostringstream os;
+        os << value;
+        return os.str();
+    }
+
+    void ring_test() {
+        I a = 12, b = -18;
+        assert(a + b == -6 && a - b == 30 && a * b == -216 && -b == 18);
+        assert(gcd(a, b) == 6 && gcd(I(0), b) == 18 && gcd(I(0), I(0)) == 0);
+        assert(b / I(3) == -6 && a > b && b <= a && a != b);
+        overflow::reset();
+        I large = INT64_MAX;
+        assert(large - I(1) + I(1) == large && -(-large) == large && !overflow::is_raised());
+        [[maybe_unused]] I wrapped = large * I(2);
+        assert(overflow::is_raised());
+        overflow::reset();
+        wrapped = -(-large - I(1));
+        assert(overflow::is_raised());
+        using P = Polynomial<MI, MonomialOrders::Grevlex>;
+        assert(to_string(P("-6x^2 + 4xy - 10 + 2x^2")) == "-4x^2 + 4xy - 10");
+        size_t pos = 0;
+        P p;
+        assert(string(P::parse("x + \\frac{1}{2}", &pos, &p)) == "Integer coefficient can't be a fraction");
+    }
+
+    void reduction_test() {
+        using P = Polynomial<MI, MonomialOrders::Grlex>;
+        P p("-6x^2y + 9xy - 3y");
+        assert(!p.is_normalized() && p.get_content() == 3);
+        p.normalize();
+        assert(p == P("2x^2y - 3xy + y") && p.is_normalized());
+        //Leading term 2x^2y is cancelled by 3xy - 1 after scaling by 3
+        P q("3xy - 1");
+        assert(q.do_one_elementary_reduction_over(p));
+        assert(p == P("-9xy + 3y + 2x"));
+        assert(get_S_polynomial(P("4x^2 + y"), P("6xy + 1")) == P("3y^2 - 2x"));
+    }
+
+    //Converts fraction-free basis to monic polynomials over the given field
+    template<typename Coefficient, typename Order>
+    vector<string> to_monic(const vector<Polynomial<Monomial<I>, Order>>& basis) {
+        vector<string> res;
+        for (const auto& p : basis) {
+            Polynomial<Monomial<Coefficient>, Order> monic(to_string(p));
+            monic.normalize();
+            res.push_back(to_string(monic));
+        }
+        sort(res.begin(), res.end());
+        return res;
+    }
+
+    template<typename Coefficient, typename Order>
+    vector<string> reduced_basis(const vector<string>& generators) {
+        Ideal<Polynomial<Monomial<Coefficient>, Order>> ideal;
+        for (const auto& s : generators) { ideal.insert(s); }
+        ideal.make_reduced_groebner_basis();
+        vector<string> res;
+        for (const auto& p : ideal.get_basis()) { res.push_back(to_string(p)); }
+        sort(res.begin(), res.end());
+        return res;
+    }
+
+    template<typename Order>
+    vector<Polynomial<Monomial<I>, Order>> fraction_free_basis(const vector<string>& generators) {
+        Ideal<Polynomial<Monomial<I>, Order>> ideal;
+        for (const auto& s : generators) { ideal.insert(s); }
+        ideal.make_reduced_groebner_basis();
+        for (const auto& p : ideal.get_basis()) { assert(p.is_normalized()); }
+        return ideal.get_basis();
+    }
+
+    template<typename Order>
+    void compare_with_fractions(const vector<string>& generators) {
+        assert((to_monic<F, Order>(fraction_free_basis<Order>(generators)) == reduced_basis<F, Order>(generators)));
+    }
+
+    template<typename Order>
+    void compare_modulo_prime(const vector<string>& generators) {
+        assert((to_monic<M, Order>(fraction_free_basis<Order>(generators)) == reduced_basis<M, Order>(generators)));
+    }
+
+    void groebner_test() {
+        compare_with_fractions<MonomialOrders::Grevlex>(systems::cyclic(4));
+        compare_with_fractions<MonomialOrders::Grevlex>(systems::eco(4));
+        compare_with_fractions<MonomialOrders::Grevlex>(systems::noon(3));
+        compare_with_fractions<MonomialOrders::Grlex>(systems::eco(4));
+        compare_with_fractions<MonomialOrders::Lex>(systems::cyclic(4));
+        compare_with_fractions<MonomialOrders::Lex>({"x^2 + 3y^2 - 4", "2xy - 5"});
+        //64-bit fractions overflow on these, so the basis is compared modulo a prime instead
+        compare_modulo_prime<MonomialOrders::Grevlex>(systems::katsura(3));
+        compare_modulo_prime<MonomialOrders::Grevlex>(systems::eco(5));
+        compare_modulo_prime<MonomialOrders::Lex>({"x^2 + 3y^2 - 4", "2xy - 5", "y^3 + 2x - 7"});
+
+        //32-bit coefficients overflow on Katsura-4
+        Ideal<Polynomial<Monomial<Integer<int32_t>>, MonomialOrders::Grevlex>> small;
+        for (const auto& s : systems::katsura(4)) { small.insert(s); }
+        assert(small.make_reduced_groebner_basis() == ComputationStatus::ArithmeticOverflow);
+        assert(small.get_basis_type() == BasisType::Any);
+    }
+}// namespace
+
+int main() {
+    ring_test();
+    reduction_test();
+    groebner_test();
+    cout << "OK" << endl;
+}
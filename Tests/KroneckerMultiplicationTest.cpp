@@ -0,0 +1,52 @@
+#include "../Library/KroneckerMultiplication.h"
+using namespace std;
+
+using M = Mint<int64_t, 998244353>;
+using MM = Monomial<M, VariableOrders::InverseAsciiOrder>;
+using PMMR = Polynomial<MM, MonomialOrders::Grevlex>;
+using M7 = Mint<int64_t, 7>;
+using PM7 = Polynomial<Monomial<M7, VariableOrders::InverseAsciiOrder>, MonomialOrders::Lex>;
+using V = Variable<int32_t, VariableOrders::InverseAsciiOrder>;
+
+namespace {
+    PMMR random_dense_polynomial(int variables, int degree, mt19937& rng) {
+        PMMR res;
+        vector<int> exponents(variables, 0);
+        uniform_int_distribution<int64_t> gen(1, M::get_modulus() - 1);
+        while (true) {
+            MM m("1");
+            m *= M(gen(rng));
+            for (int i = 0; i < variables; ++i) {
+                if (exponents[i]) { m *= MM(1, V('x', i), exponents[i]); }
+            }
+            res += m;
+            int i = 0;
+            for (; i < variables && exponents[i] == degree; ++i) { exponents[i] = 0; }
+            if (i == variables) { break; }
+            ++exponents[i];
+        }
+        return res;
+    }
+}// namespace
+
+int main() {
+    mt19937 rng(777);
+    PMMR a = random_dense_polynomial(3, 4, rng), b = random_dense_polynomial(3, 3, rng);
+    assert(kronecker_multiply(a, b) == a * b);
+    assert(kronecker::multiply(a, b) == a * b);
+    kronecker::Substitution<PMMR> substitution(a, b);
+    assert(substitution.fits && substitution.size == 8 * 8 * 8);
+    assert(kronecker::is_dense_product_profitable(a.size(), b.size(), substitution.size));
+
+    PMMR c("x_0^100y^3 + 1"), d("x_0 - y^100");
+    assert(kronecker_multiply(c, d) == c * d);
+    assert(kronecker::multiply(c, d) == c * d);
+    kronecker::Substitution<PMMR> sparse_substitution(c, d);
+    assert(!kronecker::is_dense_product_profitable(c.size(), d.size(), sparse_substitution.size));
+
+    assert(kronecker::multiply(a, PMMR()).is_zero());
+    assert(kronecker_multiply(PMMR("3"), PMMR("5")) == PMMR("15"));
+    assert(kronecker_multiply(PMMR("x + y"), PMMR("x - y")) == PMMR("x^2 - y^2"));
+    assert(kronecker::multiply(PM7("x^3 + 2y + 3"), PM7("x^3 - 2y")) == PM7("x^6 + 3x^3 - 4y^2 - 6y"));
+    cout << "OK";
+}
@@ -0,0 +1,172 @@
+#include "../Library/Ideal.h"
+#include <random>
+using namespace std;
+
+using F = Fraction<int64_t>;
+using MF = Monomial<F, VariableOrders::InverseAsciiOrder>;
+using PMFG = Polynomial<MF, MonomialOrders::Grlex>;
+using M = Mint<int64_t, 998244353>;
+using MM = Monomial<M, VariableOrders::InverseAsciiOrder>;
+using PMMR = Polynomial<MM, MonomialOrders::Grevlex>;
+
+namespace {
+    void scoped_resource_test() {
+        memory::CountingResource counting(std::pmr::new_delete_resource());
+        {
+            memory::ScopedResource scope(&counting);
+            assert(memory::get_current_resource() == &counting);
+            PMFG p("x^2y + 3z - 1");
+            assert(counting.get_allocated_bytes() > 0);
+            PMFG q = p * p;
+            assert(q == PMFG("x^4y^2 + 6x^2yz - 2x^2y + 9z^2 - 6z + 1"));
+        }
+        assert(memory::get_current_resource() == std::pmr::new_delete_resource());
+        assert(counting.get_allocated_bytes() == 0);
+        assert(counting.get_peak_allocated_bytes() > 0);
+    }
+
+    void copy_and_move_test() {
+        memory::ComputationArena arena;
+        std::optional<PMFG> in_arena;
+        {
+            memory::ScopedResource scope(arena.get_resource());
+            in_arena.emplace("xy^2 - 7z^3 + x");
+        }
+        size_t allocated = arena.get_allocated_bytes();
+        //Copy is made on the current resource, move keeps the arena
+        PMFG copied = *in_arena;
+        assert(arena.get_allocated_bytes() == allocated);
+        PMFG moved = std::move(*in_arena);
+        in_arena.reset();
+        assert(copied == moved);
+        PMFG rehomed(moved, std::pmr::new_delete_resource());
+        assert(rehomed == copied);
+    }
+
+    void groebner_basis_test() {
+        Ideal<PMFG> with_arena = {"x^2y - 1", "xy^2 - x", "z^2 - xy"};
+        Ideal<PMFG> without_arena = with_arena;
+        without_arena.set_memory_resource(nullptr);
+        with_arena.make_reduced_groebner_basis();
+        without_arena.make_reduced_groebner_basis();
+        assert(with_arena.get_basis() == without_arena.get_basis());
+        //Arena is destroyed by now, so the basis must live on the default resource
+        assert(with_arena.contains(PMFG("x^3y^3 - x")));
+    }
+
+    //Handler throws in the middle of the computation, the basis must leave the arena anyway
+    void exception_test() {
+        Ideal<PMFG> ideal = {"x^2y - 1", "xy^2 - x", "z^2 - xy"};
+        ideal.set_progress_handler([](const Ideal<PMFG>::Progress& progress) {
+            if (progress.basis_size > 3) { throw runtime_error("Interrupted"); }
+        });
+        bool was_thrown = false;
+        try {
+            ideal.make_reduced_groebner_basis();
+        } catch (const runtime_error&) {
+            was_thrown = true;
+        }
+        assert(was_thrown && ideal.get_basis_type() == BasisType::Any && ideal.basis_contains(PMFG("x^2y - 1")));
+        ideal.reset_progress_handler();
+        assert(ideal.contains(PMFG("x^3y^3 - x")));
+    }
+
+    //Copies made by handlers must not be allocated in the arena
+    void handler_copies_test() {
+        Ideal<PMFG> ideal = {"x^2y - 1", "xy^2 - x", "z^2 - xy"};
+        vector<PMFG> saved;
+        ideal.set_checkpoint_handler([&saved](const Ideal<PMFG>& ideal) { saved = ideal.get_basis(); }, {1});
+        ideal.make_reduced_groebner_basis();
+        assert(saved.size() > 3 && ideal.contains(saved.back()));
+
+        //Both the plain loop and the computation by degree, driven by the series of a computed basis
+        Ideal<PMFG> plain = {"x^2 - yz", "xy - z^2", "y^2 - xz"}, by_degree = plain;
+        vector<PMFG> logged;
+        auto log = [&logged](const Ideal<PMFG>::Progress& progress) {
+            logged.emplace_back(PMFG("x^" + to_string(progress.basis_size)));
+        };
+        plain.set_progress_handler(log);
+        plain.make_groebner_basis();
+        by_degree.set_hilbert_series(plain.get_hilbert_series());
+        by_degree.set_progress_handler(log);
+        by_degree.make_groebner_basis();
+        assert(logged.size() > 2 && logged[0] == PMFG("x^3"));
+    }
+
+    void counting_upstream_test() {
+        memory::CountingResource counting(std::pmr::new_delete_resource());
+        Ideal<PMMR> ideal = {"x + y + z", "xy + yz + zx", "xyz - 1"};
+        ideal.set_memory_resource(&counting);
+        ideal.make_reduced_groebner_basis();
+        assert(counting.get_peak_allocated_bytes() >= memory::ComputationArena::kInitialBufferSize);
+        assert(counting.get_allocated_bytes() == 0);
+        assert(ideal.is_basis_equals_to({"x + y + z", "y^2 + yz + z^2", "z^3 - 1"}));
+    }
+
+    PMMR random_polynomial(mt19937& rng, int terms) {
+        uniform_int_distribution<int> degree_gen(0, 4), coefficient_gen(-9, 9);
+        PMMR p;
+        for (int i = 0; i < terms; ++i) {
+            p += PMMR(to_string(coefficient_gen(rng)) + "x^" + to_string(degree_gen(rng)) + "y^" +
+                      to_string(degree_gen(rng)) + "z^" + to_string(degree_gen(rng)));
+        }
+        return p;
+    }
+
+    void subtract_multiple_test() {
+        mt19937 rng(32);
+        for (int i = 0; i < 100; ++i) {
+            PMMR p = random_polynomial(rng, 30), q = random_polynomial(rng, 10);
+            MM m(to_string(i % 7 - 3) + "x^" + to_string(i % 3) + "z^" + to_string(i % 2));
+            PMMR expected = p - m * q;
+            p.subtract_multiple(m, q);
+            assert(p == expected);
+        }
+        PMMR p("x^2 + 3xy - z");
+        p.subtract_multiple(MM("2"), p);
+        assert(p == PMMR("-x^2 - 3xy + z"));
+    }
+
+    void fused_reduction_allocations_test() {
+        mt19937 rng(33);
+        PMMR q = random_polynomial(rng, 40) * MM("xyz");
+        MM m("5xy^2");
+        PMMR p = m * q + random_polynomial(rng, 20);
+        PMMR materialized = p;
+        memory::CountingResource counting(std::pmr::new_delete_resource());
+        memory::ScopedResource scope(&counting);
+        //All terms of m * q are present in p and have the same variables,
+        //so only the scratch monomial takes memory, once for each of its variables
+        p.subtract_multiple(m, q);
+        size_t fused_allocations = counting.get_allocations_count();
+        assert(fused_allocations <= 3);
+        materialized -= m * q;
+        assert(counting.get_allocations_count() - fused_allocations >= q.size());
+        assert(p == materialized);
+    }
+
+    void move_allocations_test() {
+        PMMR p("3x^2y + 6z - 9");
+        vector<PMMR> polynomials = {PMMR("xy - 1"), PMMR("2y^2 - x"), PMMR("x^2 + z")};
+        memory::CountingResource counting(std::pmr::new_delete_resource());
+        memory::ScopedResource scope(&counting);
+        Ideal<PMMR> ideal(std::move(polynomials));
+        ideal.insert(std::move(p));
+        assert(counting.get_allocations_count() == 0);
+        assert(ideal.size() == 4);
+        assert(ideal.basis_contains(PMMR("x^2y + 2z - 3")));
+    }
+}// namespace
+
+int main() {
+    scoped_resource_test();
+    copy_and_move_test();
+    groebner_basis_test();
+    exception_test();
+    handler_copies_test();
+    counting_upstream_test();
+    subtract_multiple_test();
+    fused_reduction_allocations_test();
+    move_allocations_test();
+    cout << "OK" << endl;
+}
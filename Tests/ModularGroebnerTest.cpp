@@ -0,0 +1,104 @@
+#include "../Library/ModularGroebner.h"
+#include "TestUtilities.h"
+using namespace std;
+using namespace tests;
+
+using R = RuntimeMint<int64_t>;
+using PF = Polynomial<Monomial<Fraction<int64_t>, VariableOrders::InverseAsciiOrder>, MonomialOrders::Grevlex>;
+using PL = Polynomial<Monomial<Fraction<int64_t>, VariableOrders::InverseAsciiOrder>, MonomialOrders::Lex>;
+using PI = Polynomial<Monomial<Integer<int64_t>, VariableOrders::InverseAsciiOrder>, MonomialOrders::Grevlex>;
+
+namespace {
+    const vector<string> kRational = {"\\frac{1}{3}x^2 + \\frac{2}{5}y - 1", "xy - \\frac{7}{2}"};
+
+    void runtime_mint_test() {
+        R::set_modulus(1000000007);
+        R a = 123456789, b = -5;
+        assert(b.get_value() == 1000000002 && (-b).get_value() == 5);
+        assert((a + b).get_value() == 123456784 && (b - a).get_value() == 1000000007 - 123456794);
+        assert((a * invert(a)).get_value() == 1 && (a / b * b) == a);
+        assert(pow(R(2), 30).get_value() == (int64_t(1) << 30) % 1000000007);
+        R::set_modulus(7);
+        assert(R(int64_t(100)).get_value() == 2 && (R(3) / R(5)).get_value() == 2);
+    }
+
+    template<typename Polynom>
+    void compare_with_direct_computation(const vector<string>& generators, size_t workers, bool use_trace = false) {
+        Ideal<Polynom> direct = make_ideal<Polynom>(generators);
+        direct.make_reduced_groebner_basis();
+        Ideal<Polynom> ideal = make_ideal<Polynom>(generators);
+        modular::Options options;
+        options.workers = workers;
+        options.use_trace = use_trace;
+        assert(modular::make_reduced_groebner_basis(&ideal, options) == nullptr);
+        assert(ideal.get_basis_type() == BasisType::ReducedGroebner);
+        assert(are_same_bases(ideal, direct));
+    }
+
+    void rational_test() {
+        for (size_t workers : {1, 4}) {
+            compare_with_direct_computation<PF>(systems::cyclic(4), workers);
+            compare_with_direct_computation<PF>(kRational, workers);
+            compare_with_direct_computation<PL>(kRational, workers);
+            compare_with_direct_computation<PF>({"x^2 + 1", "x^2 - 1"}, workers);
+            compare_with_direct_computation<PF>({}, workers);
+        }
+        //Workers replay the trace learned modulo a prime none of them uses
+        compare_with_direct_computation<PF>(systems::cyclic(4), 4, true);
+        compare_with_direct_computation<PL>(kRational, 2, true);
+        //The first prime divides a denominator, it's skipped by workers and by learning of the trace
+        const vector<string> kUnluckyFirstPrime = {"\\frac{1}{2147483647}x - \\frac{1}{2147483647}y", "x^2 - 3"};
+        compare_with_direct_computation<PF>(kUnluckyFirstPrime, 2);
+        compare_with_direct_computation<PF>(kUnluckyFirstPrime, 2, true);
+    }
+
+    //Fractions of the direct computation overflow here, the basis is compared with the fraction-free one
+    void large_coefficients_test(bool use_trace) {
+        Ideal<PI> integral = make_ideal<PI>(systems::katsura(3));
+        integral.make_reduced_groebner_basis();
+        Ideal<PF> ideal = make_ideal<PF>(systems::katsura(3));
+        modular::Options options;
+        options.use_trace = use_trace;
+        assert(modular::make_reduced_groebner_basis(&ideal, options) == nullptr);
+        assert(ideal.size() == integral.size());
+        for (const PI& p : integral.get_basis()) {
+            PF monic;
+            int64_t leading = p.get_highest_monomial().get_coefficient().get_value();
+            for (const auto& m : p.get_monomials_ascending_order()) {
+                vector<pair<PF::Monom_::Variable_, int64_t>> powers;
+                for (const auto& [var, deg] : m.get_variables_ascending_order()) { powers.emplace_back(var, deg); }
+                monic.append_highest_monomial({Fraction<int64_t>(m.get_coefficient().get_value(), leading), powers});
+            }
+            assert(ideal.basis_contains(monic));
+        }
+    }
+
+    void error_test() {
+        //Stabilization needs at least one prime beyond the ones used for reconstruction
+        Ideal<PF> ideal = make_ideal<PF>(systems::cyclic(4));
+        modular::Options options;
+        options.workers = 1;
+        options.max_primes = 1;
+        assert(modular::make_reduced_groebner_basis(&ideal, options) != nullptr);
+        assert(ideal.get_basis_type() == BasisType::Any && ideal.size() == systems::cyclic(4).size());
+
+        //Reduced basis has 3 / 2147483647^2, which is beyond the reconstruction bound of 128-bit moduli
+        Ideal<PF> large = make_ideal<PF>({"\\frac{1}{2147483647}x + y", "x^2 - 3y"});
+        assert(string(modular::make_reduced_groebner_basis(&large, options = {})) ==
+               "Coefficients don't fit into 64-bit fractions");
+
+        options.workers = 1;
+        options.max_primes = 8;
+        options.memory_limit_bytes = 1;
+        assert(string(modular::make_reduced_groebner_basis(&ideal, options)) == "Worker exceeded computation limits");
+    }
+}// namespace
+
+int main() {
+    runtime_mint_test();
+    rational_test();
+    large_coefficients_test(false);
+    large_coefficients_test(true);
+    error_test();
+    cout << "OK" << endl;
+}
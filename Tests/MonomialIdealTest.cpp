@@ -0,0 +1,147 @@
+#include "../Library/Ideal.h"
+#include "../Library/MonomialIdeal.h"
+#include <random>
+using namespace std;
+
+using M = Mint<int64_t, 998244353>;
+using MM = Monomial<M, VariableOrders::InverseAsciiOrder>;
+using PR = Polynomial<MM, MonomialOrders::Grevlex>;
+using Exponents = MonomialIdeal::Exponents;
+
+namespace {
+    bool is_divisible(const Exponents& m, const Exponents& divisor) {
+        for (size_t i = 0; i < divisor.size(); ++i) {
+            if ((i < m.size() ? m[i] : 0) < divisor[i]) { return false; }
+        }
+        return true;
+    }
+
+    bool naive_contains(const vector<Exponents>& generators, const Exponents& m) {
+        return any_of(generators.begin(), generators.end(), [&m](const Exponents& g) { return is_divisible(m, g); });
+    }
+
+    Exponents random_monomial(mt19937& rng, size_t n, int64_t max_exponent) {
+        Exponents m(n);
+        for (auto& e : m) { e = rng() % (max_exponent + 1); }
+        return m;
+    }
+
+    void basic_test() {
+        MonomialIdeal ideal({{2, 0}, {1, 1}, {2, 1}, {0, 3}, {1, 1}}, 2);
+        assert(ideal.size() == 3);
+        assert((ideal.get_generators() == vector<Exponents>{{2, 0}, {1, 1}, {0, 3}}));
+        assert(ideal.contains({3, 0}) && ideal.contains({1, 2}) && !ideal.contains({1, 0}) && !ideal.contains({}));
+        assert((*ideal.find_divisor({1, 2}) == Exponents{1, 1}));
+        assert(ideal.is_zero_dimensional());
+        assert((ideal.get_standard_monomials() == vector<Exponents>{{0, 0}, {1, 0}, {0, 1}, {0, 2}}));
+        assert((ideal.colon({1, 0}).get_generators() == vector<Exponents>{{1, 0}, {0, 1}}));
+        assert((MonomialIdeal::select_minimal({{1, 1}, {1}, {1, 0}, {0, 2}}, 2) == vector<size_t>{1, 3}));
+
+        //Generators divisible by the new one are removed
+        assert(!ideal.insert({3, 3}));
+        assert(ideal.insert({0, 1}));
+        assert((ideal.get_generators() == vector<Exponents>{{0, 1}, {2, 0}}));
+
+        MonomialIdeal line({{1, 0, 0}, {0, 1, 0}}, 3);
+        assert(!line.is_zero_dimensional());
+        assert(line.get_standard_monomials(3).size() == 4 && line.get_standard_monomials().empty());
+        assert(MonomialIdeal({{}}, 2).get_standard_monomials().empty());
+        assert(MonomialIdeal(0).get_standard_monomials().size() == 1);
+    }
+
+    void random_test() {
+        mt19937 rng(46);
+        for (int iteration = 0; iteration < 300; ++iteration) {
+            size_t n = 1 + rng() % 5;
+            int64_t max_exponent = 1 + rng() % 4;
+            vector<Exponents> monomials(rng() % 30);
+            for (auto& m : monomials) { m = random_monomial(rng, n, max_exponent); }
+            MonomialIdeal ideal(monomials, n);
+
+            //Minimal generators are the monomials, which aren't divisible by others
+            vector<Exponents> minimal;
+            for (size_t i = 0; i < monomials.size(); ++i) {
+                bool is_redundant = false;
+                for (size_t j = 0; j < monomials.size(); ++j) {
+                    bool is_earlier_copy = monomials[i] == monomials[j] && j < i;
+                    is_redundant |= i != j && is_divisible(monomials[i], monomials[j]) &&
+                                    (monomials[i] != monomials[j] || is_earlier_copy);
+                }
+                if (!is_redundant) { minimal.push_back(monomials[i]); }
+            }
+            vector<Exponents> generators = ideal.get_generators();
+            assert(is_permutation(generators.begin(), generators.end(), minimal.begin(), minimal.end()));
+            assert(is_sorted(generators.begin(), generators.end(), [](const Exponents& m1, const Exponents& m2) {
+                return MonomialIdeal::get_degree(m1) < MonomialIdeal::get_degree(m2);
+            }));
+
+            //Membership and colon
+            Exponents divisor = random_monomial(rng, n, 2);
+            MonomialIdeal colon = ideal.colon(divisor);
+            for (int query = 0; query < 30; ++query) {
+                Exponents m = random_monomial(rng, n, max_exponent + 1);
+                assert(ideal.contains(m) == naive_contains(monomials, m));
+                Exponents product = m;
+                for (size_t i = 0; i < n; ++i) { product[i] += divisor[i]; }
+                assert(colon.contains(m) == ideal.contains(product));
+            }
+
+            //Standard monomials of bounded degree
+            int64_t max_degree = 4;
+            vector<Exponents> standard;
+            ideal.for_each_standard_monomial(max_degree, [&](const Exponents& m, size_t parent, size_t v) {
+                assert(!naive_contains(monomials, m));
+                if (parent == SIZE_MAX) {
+                    assert(standard.empty() && MonomialIdeal::get_degree(m) == 0);
+                } else {
+                    Exponents product = standard[parent];
+                    ++product[v];
+                    assert(product == m);
+                }
+                standard.push_back(m);
+            });
+            size_t count = 0;
+            auto enumerate = [&](auto&& self, Exponents& m, size_t i) -> void {
+                if (i == n) {
+                    count += MonomialIdeal::get_degree(m) <= max_degree && !naive_contains(monomials, m);
+                    return;
+                }
+                for (m[i] = 0; m[i] <= max_degree; ++m[i]) { self(self, m, i + 1); }
+            };
+            Exponents m(n);
+            enumerate(enumerate, m, 0);
+            assert(standard.size() == count);
+
+            //Incremental insertion gives the same ideal
+            MonomialIdeal incremental(n);
+            for (const auto& monomial : monomials) { incremental.insert(monomial); }
+            generators = incremental.get_generators();
+            assert(is_permutation(generators.begin(), generators.end(), minimal.begin(), minimal.end()));
+        }
+    }
+
+    void minimal_basis_test() {
+        Ideal<PR> ideal({PR("a + b + c + d"), PR("ab + bc + cd + da"), PR("abc + bcd + cda + dab"), PR("abcd - 1")});
+        ideal.make_groebner_basis();
+        size_t groebner_size = ideal.get_basis().size();
+        ideal.make_minimal_groebner_basis();
+        const auto& basis = ideal.get_basis();
+        assert(basis.size() < groebner_size);
+        for (size_t i = 0; i < basis.size(); ++i) {
+            auto leading = basis[i].get_highest_monomial();
+            for (size_t j = 0; j < basis.size(); ++j) {
+                assert(i == j || !leading.is_divisible_on(basis[j].get_highest_monomial()));
+            }
+        }
+        Ideal<PR> reduced({PR("a + b + c + d"), PR("ab + bc + cd + da"), PR("abc + bcd + cda + dab"), PR("abcd - 1")});
+        reduced.make_reduced_groebner_basis();
+        assert(basis.size() == reduced.get_basis().size());
+    }
+}// namespace
+
+int main() {
+    basic_test();
+    random_test();
+    minimal_basis_test();
+    cout << "OK" << endl;
+}
@@ -0,0 +1,89 @@
+#include "../Library/Ideal.h"
+#include <random>
+using namespace std;
+
+using M = Mint<int64_t, 998244353>;
+using MM = Monomial<M, VariableOrders::InverseAsciiOrder>;
+using PMMR = Polynomial<MM, MonomialOrders::Grevlex>;
+using PMML = Polynomial<MM, MonomialOrders::Lex>;
+
+namespace {
+    template<typename Polynom>
+    vector<Polynom> generate_polynomials(int count) {
+        mt19937 rng(777);
+        uniform_int_distribution<int> degree_gen(0, 4), coefficient_gen(-9, 9);
+        vector<Polynom> res;
+        for (int i = 0; i < count; ++i) {
+            Polynom p;
+            for (int j = 0; j < 5; ++j) {
+                p += Polynom(to_string(coefficient_gen(rng)) + "x^" + to_string(degree_gen(rng)) + "y^" +
+                             to_string(degree_gen(rng)) + "z^" + to_string(degree_gen(rng)));
+            }
+            res.push_back(p);
+        }
+        return res;
+    }
+
+    template<typename Polynom>
+    void compare_with_plain_reduction(Ideal<Polynom> ideal) {
+        ideal.make_reduced_groebner_basis();
+        auto polynomials = generate_polynomials<Polynom>(50);
+        vector<Polynom> expected;
+        for (const auto& p : polynomials) { expected.push_back(ideal.get_normal_form(p)); }
+        ideal.enable_normal_form_cache();
+        for (size_t i = 0; i < polynomials.size(); ++i) {
+            assert(ideal.get_normal_form(polynomials[i]) == expected[i]);
+        }
+        auto statistics = ideal.get_normal_form_cache_statistics();
+        assert(statistics.hits > 0 && statistics.misses > 0);
+        assert(statistics.evictions == 0);
+        assert(statistics.entries > 0);
+
+        ideal.enable_normal_form_cache(30);
+        for (size_t i = 0; i < polynomials.size(); ++i) {
+            assert(ideal.get_normal_form(polynomials[i]) == expected[i]);
+        }
+        statistics = ideal.get_normal_form_cache_statistics();
+        assert(statistics.evictions > 0);
+        assert(statistics.terms <= 30);
+    }
+
+    void invalidation_test() {
+        Ideal<PMMR> ideal = {"x^2 - y", "y^2 - z"};
+        ideal.make_reduced_groebner_basis();
+        ideal.enable_normal_form_cache();
+        assert(ideal.get_normal_form(PMMR("x^4")) == PMMR("z"));
+        assert(ideal.get_normal_form_cache_statistics().entries > 0);
+        ideal.insert("z - 1");
+        assert(ideal.get_normal_form_cache_statistics().entries == 0);
+        ideal.make_reduced_groebner_basis();
+        assert(ideal.get_normal_form(PMMR("x^4")) == PMMR("1"));
+        assert(ideal.contains(PMMR("x^4 - 1")));
+        ideal.disable_normal_form_cache();
+        assert(!ideal.is_normal_form_cache_enabled());
+        assert(ideal.contains(PMMR("x^4 - 1")));
+    }
+
+    //Copies of a cached ideal keep their own usage order
+    void copy_test() {
+        Ideal<PMMR> ideal = {"x^2 - y", "y^2 - z"};
+        ideal.make_reduced_groebner_basis();
+        ideal.enable_normal_form_cache();
+        assert(ideal.get_normal_form(PMMR("x^4 + xy^3")) == PMMR("xyz + z"));
+        Ideal<PMMR> copy = ideal;
+        ideal = {"x - 1"};
+        assert(copy.get_normal_form(PMMR("x^4 + xy^3")) == PMMR("xyz + z"));
+        assert(copy.get_normal_form_cache_statistics().hits > 0);
+        ideal = copy;
+        copy = {"y - 1"};
+        assert(ideal.contains(PMMR("x^4 - z")) && ideal.get_normal_form(PMMR("y^2x^2")) == PMMR("yz"));
+    }
+}// namespace
+
+int main() {
+    compare_with_plain_reduction(Ideal<PMMR>{"x^2 + y^2 + z^2 - 1", "xy - z", "y^3 - x"});
+    compare_with_plain_reduction(Ideal<PMML>{"x^2 - yz", "y^2 - xz + 1", "z^2 - xy"});
+    invalidation_test();
+    copy_test();
+    cout << "OK";
+}
@@ -0,0 +1,167 @@
+#include "../Benchmarks/Systems.h"
+#include "../Library/Ideal.h"
+#include "../Library/PackedMonomial.h"
+#include <random>
+#include <sstream>
+using namespace std;
+
+using M = Mint<int64_t, 998244353>;
+using MM = Monomial<M>;
+using PM4 = PackedMonomial<M, 4>;
+using PM5 = PackedMonomial<M, 5>;
+using PM11 = PackedMonomial<M, 11>;
+using PM5W = PackedMonomial<M, 5, uint16_t>;
+using PR4 = PackedMonomial<M, 4, uint8_t, PackedLayout::Grevlex>;
+using PR5 = PackedMonomial<M, 5, uint8_t, PackedLayout::Grevlex>;
+using PR13 = PackedMonomial<M, 13, uint8_t, PackedLayout::Grevlex>;
+using PR3W = PackedMonomial<M, 3, uint32_t, PackedLayout::Grevlex>;
+
+namespace {
+    template<typename T>
+    string to_string(const T& value) {
+        ostringstream os;
+        os << value;
+        return os.str();
+    }
+
+    template<typename Packed>
+    Packed random_monomial(mt19937& rng, size_t variables, int max_exponent) {
+        uniform_int_distribution<int> exponent(0, max_exponent), coefficient(1, 100);
+        string s = std::to_string(coefficient(rng));
+        for (size_t i = 0; i < variables; ++i) { s += "x_" + std::to_string(i) + "^" + std::to_string(exponent(rng)); }
+        return Packed(s);
+    }
+
+    //Every operation must agree with the map-based monomial
+    template<typename Packed>
+    void compare_with_monomial(size_t variables, int max_exponent) {
+        mt19937 rng(variables * 1000 + max_exponent);
+        for (int iteration = 0; iteration < 2000; ++iteration) {
+            Packed a = random_monomial<Packed>(rng, variables, max_exponent);
+            Packed b = random_monomial<Packed>(rng, variables, max_exponent);
+            if (iteration % 7 == 0) { b = a * Packed("x_0"); }
+            MM ma(to_string(a)), mb(to_string(b));
+            assert(a.get_degree() == ma.get_degree());
+            assert(to_string(a * b) == to_string(ma * mb));
+            assert(a.is_divisible_on(b) == ma.is_divisible_on(mb));
+            assert(b.is_divisible_on(a) == mb.is_divisible_on(ma));
+            if (b.is_divisible_on(a)) { assert(to_string(b / a) == to_string(mb / ma)); }
+            assert(to_string(gcd(a, b)) == to_string(gcd(ma, mb)));
+            assert(to_string(lcm(a, b)) == to_string(lcm(ma, mb)));
+            assert(MonomialOrders::Lex()(a, b) == MonomialOrders::Lex()(ma, mb));
+            assert(MonomialOrders::Grlex()(a, b) == MonomialOrders::Grlex()(ma, mb));
+            assert(MonomialOrders::Grevlex()(a, b) == MonomialOrders::Grevlex()(ma, mb));
+            assert(MonomialOrders::Grevlex()(b, a) == MonomialOrders::Grevlex()(mb, ma));
+        }
+    }
+
+    void operations_test() {
+        PM4 m("3x_0^2x_3");
+        assert(m.get_degree() == 3 && m.get_exponent(0) == 2 && m.get_exponent(1) == 0 && m.get_exponent(3) == 1);
+        assert(to_string(m * Variable<int32_t>('x', 1)) == "3x_0^2x_1x_3");
+        assert(to_string(m / M(3)) == "x_0^2x_3" && (-m).get_coefficient() == M(-3));
+        assert((m * M(0)).is_zero() && (m * M(0)).get_degree() == 0);
+        assert(m.is_divisible_on(PM4("x_0x_3")) && !m.is_divisible_on(PM4("x_1")) && !m.is_divisible_on(PM4()));
+        assert(PM4().is_divisible_on(m) && PM4("1").get_degree() == 0);
+        m.increase_coefficient(-3);
+        assert(m == PM4::ZeroMonomial());
+        compare_with_monomial<PM4>(4, 5);
+        compare_with_monomial<PM11>(11, 3);
+        compare_with_monomial<PM5W>(5, 300);
+        compare_with_monomial<PR4>(4, 5);
+        compare_with_monomial<PR13>(13, 2);
+        compare_with_monomial<PR3W>(3, 100000);
+    }
+
+    void overflow_test() {
+        static_assert(PM4::kMaxExponent == 127 && PM5W::kMaxExponent == 32767);
+        PM4 a("x_0^100x_3^27"), b("x_0^27x_3^100");
+        assert(!a.is_product_overflowing(b) && (a * b).get_degree() == 254);
+        assert(a.is_product_overflowing(PM4("x_3^101")) && !a.is_product_overflowing(PM4("x_3^100")));
+        assert(!a.is_product_overflowing(PM4("x_1^127")));
+        //Lanes next to the limit don't leak into each other
+        PM4 full("x_0^127x_1^127x_2^127x_3^127");
+        assert(full.is_divisible_on(a) && !a.is_divisible_on(full) && lcm(a, full) == full && gcd(a, full) == a);
+        assert(to_string(full / a) == "x_0^27x_1^127x_2^127x_3^100");
+
+        overflow::reset();
+        [[maybe_unused]] PM4 product = a * b * PM4("x_1^127");
+        assert(!overflow::is_raised());
+        product = a * PM4("x_3^101");
+        assert(overflow::is_raised());
+        overflow::reset();
+        product = full * PM4::Variable_('x', 2);
+        assert(overflow::is_raised() && product == full);
+
+        //Reduced basis contains x_1^200 - x_1, the computation stops and keeps its basis
+        using Polynom = Polynomial<PM4, MonomialOrders::Lex>;
+        Ideal<Polynom> ideal = {"x_0 - x_1^100", "x_0^2 - x_1"};
+        assert(ideal.make_reduced_groebner_basis() == ComputationStatus::ArithmeticOverflow);
+        assert(ideal.get_basis_type() == BasisType::Any && ideal.size() == 2);
+    }
+
+    void layout_test() {
+        using namespace MonomialOrders;
+        static_assert(PackedComparable<PM4, Grlex> && PackedComparable<PM4, Lex> && !PackedComparable<PM4, Grevlex>);
+        static_assert(PackedComparable<PR4, Grevlex> && !PackedComparable<PR4, Grlex> && !PackedComparable<MM, Grlex>);
+        //Degree field takes 16 bits before exponents
+        static_assert(sizeof(PM4) == sizeof(M) + 8 && sizeof(PackedMonomial<M, 7>) == sizeof(M) + 16);
+        static_assert(PM4::kMaxDegree == 32767 && PR3W::kMaxDegree == (int64_t(1) << 31) - 1);
+        assert(Grevlex()(PR4("x_0x_3^2"), PR4("x_0^2x_3")) && !Grevlex()(PR4("x_0^2x_3"), PR4("x_0x_3^2")));
+        assert(Grevlex()(PR4("x_0^5"), PR4("x_3^6")) && !Grevlex()(PR4("x_1"), PR4("x_1")));
+        assert(Grlex()(PM4("x_1^2x_2"), PM4("x_0x_3^2")) && Lex()(PM4("x_1^2x_2"), PM4("x_0")));
+        //Degree is kept through every operation
+        PR13 a("x_0^100x_12^100x_6^100"), b("x_12^27x_5");
+        assert((a * b).get_degree() == 328 && (a * b / b).get_degree() == 300);
+        assert(lcm(a, b).get_degree() == 301 && gcd(a, b).get_degree() == 27);
+    }
+
+    void parse_test() {
+        auto error = [](string_view s) {
+            size_t pos = 0;
+            PM4 m;
+            const char* message = PM4::parse(s, &pos, &m);
+            return string(message ? message : "");
+        };
+        assert(error("x_4") == "Variable is out of the packed monomial");
+        assert(error("y") == "Variable is out of the packed monomial");
+        assert(error("x_1^128") == "Exponent is too large for the packed monomial");
+        assert(error("2x_1^127x_2x_2").empty());
+        assert(PM4("x_2x_2^3") == PM4("x_2^4"));
+        assert((PackedMonomial<M, 3, uint8_t, PackedLayout::Grlex, 'a'>("a_0a_2^2").get_degree() == 3));
+    }
+
+    template<typename Polynom>
+    vector<string> reduced_basis(const vector<string>& generators) {
+        Ideal<Polynom> ideal;
+        for (const auto& p : generators) { ideal.insert(Polynom(p)); }
+        ideal.make_reduced_groebner_basis();
+        vector<string> res;
+        for (const auto& p : ideal.get_basis()) { res.push_back(to_string(p)); }
+        sort(res.begin(), res.end());
+        return res;
+    }
+
+    void groebner_test() {
+        //Cyclic system doesn't use x_0
+        vector<string> cyclic = systems::cyclic(4);
+        assert((reduced_basis<Polynomial<PM5, MonomialOrders::Grevlex>>(cyclic) ==
+                reduced_basis<Polynomial<MM, MonomialOrders::Grevlex>>(cyclic)));
+        assert((reduced_basis<Polynomial<PR5, MonomialOrders::Grevlex>>(cyclic) ==
+                reduced_basis<Polynomial<MM, MonomialOrders::Grevlex>>(cyclic)));
+        assert((reduced_basis<Polynomial<PM5, MonomialOrders::Lex>>(cyclic) ==
+                reduced_basis<Polynomial<MM, MonomialOrders::Lex>>(cyclic)));
+        vector<string> katsura = systems::katsura(3);
+        assert((reduced_basis<Polynomial<PM4, MonomialOrders::Grlex>>(katsura) ==
+                reduced_basis<Polynomial<MM, MonomialOrders::Grlex>>(katsura)));
+    }
+}// namespace
+
+int main() {
+    operations_test();
+    overflow_test();
+    layout_test();
+    parse_test();
+    groebner_test();
+    cout << "OK" << endl;
+}
@@ -0,0 +1,60 @@
+#include "../Library/QuotientRing.h"
+#include <random>
+using namespace std;
+
+using M = Mint<int64_t, 998244353>;
+using MM = Monomial<M, VariableOrders::InverseAsciiOrder>;
+using PMMR = Polynomial<MM, MonomialOrders::Grevlex>;
+using F = Fraction<int64_t>;
+using MF = Monomial<F, VariableOrders::InverseAsciiOrder>;
+using PMFL = Polynomial<MF, MonomialOrders::Lex>;
+
+namespace {
+    template<typename Polynom>
+    Polynom random_polynomial(mt19937& rng) {
+        uniform_int_distribution<int> degree_gen(0, 3), coefficient_gen(-5, 5);
+        Polynom p;
+        for (int j = 0; j < 4; ++j) {
+            p += Polynom(to_string(coefficient_gen(rng)) + "x^" + to_string(degree_gen(rng)) + "y^" +
+                         to_string(degree_gen(rng)) + "z^" + to_string(degree_gen(rng)));
+        }
+        return p;
+    }
+
+    template<typename Polynom>
+    void check_arithmetic(const Ideal<Polynom>& ideal, size_t expected_dimension) {
+        QuotientRing<Polynom> ring(ideal);
+        assert(ring.dimension() == expected_dimension);
+        Ideal<Polynom> reduced = ideal;
+        reduced.make_reduced_groebner_basis();
+        mt19937 rng(777);
+        for (int i = 0; i < 20; ++i) {
+            Polynom p = random_polynomial<Polynom>(rng), q = random_polynomial<Polynom>(rng);
+            auto a = ring.to_element(p), b = ring.to_element(q);
+            assert(ring.to_polynomial(a) == reduced.get_normal_form(p));
+            assert(ring.to_polynomial(ring.multiply(a, b)) == reduced.get_normal_form(p * q));
+            assert(ring.to_polynomial(ring.add(a, b)) == reduced.get_normal_form(p + q));
+            assert(ring.to_polynomial(ring.subtract(a, b)) == reduced.get_normal_form(p - q));
+            assert(ring.pow(a, 3) == ring.multiply(a, ring.multiply(a, a)));
+        }
+        for (size_t v = 0; v < ring.get_variables().size(); ++v) {
+            auto x = ring.to_element(Polynom(typename Polynom::Monom_(1, ring.get_variables()[v], 1)));
+            assert(ring.multiply_by_variable(ring.one(), v) == x);
+        }
+    }
+}// namespace
+
+int main() {
+    check_arithmetic(Ideal<PMMR>{"x^2 + y^2 + z^2 - 1", "xy - z", "y^3 - x"}, 8);
+    check_arithmetic(Ideal<PMMR>{"x^3 - 2", "y^2 - x - 1", "z^2 - y"}, 12);
+    check_arithmetic(Ideal<PMFL>{"x^2 - y", "y^2 - z", "z^2 - 1"}, 8);
+    QuotientRing<PMMR> ring(Ideal<PMMR>{"x^2 - 1", "y - x"});
+    assert(ring.dimension() == 2);
+    assert(ring.get_standard_monomials()[0] == MM("1"));
+    assert(ring.to_element(PMMR("x^5 + y")) == ring.to_element(PMMR("2x")));
+    QuotientRing<PMMR> trivial(Ideal<PMMR>{"x - 1", "x"});
+    assert(trivial.dimension() == 0 && trivial.get_error() == nullptr);
+    QuotientRing<PMMR> infinite(Ideal<PMMR>{"x^2 - y", "xz - 1"});
+    assert(infinite.get_error() != nullptr && infinite.dimension() == 0);
+    cout << "OK";
+}
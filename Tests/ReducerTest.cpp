@@ -0,0 +1,75 @@
+#include "../Library/Ideal.h"
+#include <random>
+using namespace std;
+
+using F = Fraction<int64_t>;
+using MF = Monomial<F, VariableOrders::InverseAsciiOrder>;
+using PMFG = Polynomial<MF, MonomialOrders::Grlex>;
+using M = Mint<int64_t, 998244353>;
+using MM = Monomial<M, VariableOrders::InverseAsciiOrder>;
+using PMMR = Polynomial<MM, MonomialOrders::Grevlex>;
+using PI = Polynomial<Monomial<Integer<int64_t>>, MonomialOrders::Grevlex>;
+
+namespace {
+    void reducer_test() {
+        Ideal<PMFG> ideal = {"xz - y^2", "x^3 - z^2"};
+        ideal.make_reduced_groebner_basis();
+        Reducer<PMFG> reducer = ideal.get_reducer();
+        assert(reducer.size() == ideal.size());
+        assert(reducer.is_reducible(MF("x^3y")));
+        assert(!reducer.is_reducible(MF("y^3")));
+        assert(reducer.normal_form(PMFG("-4x^2y^2z^2 + y^6 + 3z^5")).is_zero());
+        PMFG p("xy - 5z^2 + x");
+        assert(reducer.normal_form(p) == p);
+        PMFG q("x^2z + y");
+        PMFG expected = q;
+        ideal.reduce(&expected);
+        assert(reducer.normal_form(q) == expected);
+    }
+
+    void integer_test() {
+        Ideal<PI> ideal = {"2x + 1", "y^2 - 3"};
+        ideal.make_reduced_groebner_basis();
+        Reducer<PI> reducer = ideal.get_reducer();
+        assert(reducer.normal_form(PI("3x")) == PI("1"));
+        assert(reducer.normal_form(PI("3x")) == ideal.get_normal_form(PI("3x")));
+        assert(reducer.normal_form(PI("4x^2 - 1")).is_zero());
+        assert(reducer.normal_form(PI("6xy^3 + 3y")) == PI("y"));
+        assert(reducer.normal_form(PI("5y")) == PI("y"));
+    }
+
+    void contains_each_test() {
+        Ideal<PMMR> ideal = {"x^2 + y^2 + z^2 - 1", "xy - z", "y^3 - x"};
+        ideal.make_reduced_groebner_basis();
+        mt19937 rng(777);
+        uniform_int_distribution<int> degree_gen(0, 3), coefficient_gen(-5, 5);
+        vector<PMMR> polynomials;
+        for (int i = 0; i < 200; ++i) {
+            PMMR p;
+            for (int j = 0; j < 4; ++j) {
+                string monomial = to_string(coefficient_gen(rng)) + "x^" + to_string(degree_gen(rng)) + "y^" +
+                                  to_string(degree_gen(rng)) + "z^" + to_string(degree_gen(rng));
+                p += PMMR(monomial);
+            }
+            if (i % 2 == 0) { p *= PMMR("xy - z"); }
+            polynomials.push_back(p);
+        }
+        auto sequential = ideal.contains_each(polynomials, 1);
+        auto parallel = ideal.contains_each(polynomials, 4);
+        assert(sequential.size() == polynomials.size() && parallel.size() == polynomials.size());
+        for (size_t i = 0; i < polynomials.size(); ++i) {
+            assert(sequential[i].contains == parallel[i].contains);
+            assert(sequential[i].remainder == parallel[i].remainder);
+            assert(parallel[i].contains == ideal.is_redusable_to_zero(polynomials[i]));
+            if (i % 2 == 0) { assert(parallel[i].contains); }
+        }
+        assert(ideal.contains_each({}).empty());
+    }
+}// namespace
+
+int main() {
+    reducer_test();
+    integer_test();
+    contains_each_test();
+    cout << "OK";
+}
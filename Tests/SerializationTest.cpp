@@ -0,0 +1,219 @@
+#include "../Library/Serialization.h"
+#include <cstdio>
+#include <sstream>
+using namespace std;
+
+using F = Fraction<int64_t>;
+using MF = Monomial<F, VariableOrders::InverseAsciiOrder>;
+using PMFG = Polynomial<MF, MonomialOrders::Grlex>;
+using M = Mint<int64_t, 998244353>;
+using MM = Monomial<M, VariableOrders::InverseAsciiOrder>;
+using PMMR = Polynomial<MM, MonomialOrders::Grevlex>;
+using M2 = Mint<int64_t, 1000000007>;
+using PM2R = Polynomial<Monomial<M2, VariableOrders::InverseAsciiOrder>, MonomialOrders::Grevlex>;
+using PR = Polynomial<Monomial<RuntimeMint<int64_t>>, MonomialOrders::Grevlex>;
+using PI = Polynomial<Monomial<Integer<int64_t>>, MonomialOrders::Grevlex>;
+using PF32 = Polynomial<Monomial<Fraction<int32_t>>, MonomialOrders::Grevlex>;
+
+namespace {
+    void polynomial_test() {
+        for (const char* s : {"\\frac{-3}{7}x^2y_1 + 5z^40 - 1", "0", "x_0x_1^2x_2^3 - \\frac{1}{2}"}) {
+            PMFG p(s), q;
+            stringstream stream;
+            serialization::write(stream, p);
+            assert(serialization::read(stream, &q) == nullptr);
+            assert(p == q);
+        }
+        PMMR p("998244352a^3 + 17bC_5"), q;
+        stringstream stream;
+        serialization::write(stream, p);
+        assert(serialization::read(stream, &q) == nullptr);
+        assert(p == q);
+    }
+
+    void ideal_test() {
+        Ideal<PMMR> ideal = {"x^2 + y^2 + z^2 - 1", "xy - z", "y^3 - x"};
+        ideal.make_reduced_groebner_basis();
+        stringstream stream;
+        serialization::write(stream, ideal);
+        string data = stream.str();
+        assert(data.size() % serialization::kAlignment == 0);
+        Ideal<PMMR> loaded;
+        assert(serialization::read(stream, &loaded) == nullptr);
+        assert(loaded.get_basis() == ideal.get_basis());
+        assert(loaded.get_basis_type() == BasisType::ReducedGroebner);
+        vector<uint64_t> aligned(data.size() / sizeof(uint64_t));
+        memcpy(aligned.data(), data.data(), data.size());
+        serialization::View<PMMR> view(string_view(reinterpret_cast<const char*>(aligned.data()), data.size()),
+                                       serialization::Kind::Ideal);
+        assert(view.get_error() == nullptr);
+        assert(view.size() == ideal.size() && view.get_variables().size() == 3);
+        for (size_t i = 0; i < view.size(); ++i) {
+            assert(view.get_terms_count(i) == ideal.get_basis()[i].size());
+            PMMR p;
+            assert(view.get_polynomial(i, &p) == nullptr && p == ideal.get_basis()[i]);
+        }
+    }
+
+    void file_test() {
+        Ideal<PMFG> ideal = {"x^3 - 2xy", "x^2y - 2y^2 + x"};
+        ideal.make_groebner_basis();
+        string path = "serialization_test.bin";
+        assert(serialization::save(path, ideal));
+        Ideal<PMFG> loaded;
+        assert(serialization::load(path, &loaded) == nullptr);
+        assert(loaded.get_basis() == ideal.get_basis());
+        assert(loaded.get_basis_type() == BasisType::Groebner);
+        assert(loaded.contains(PMFG("x^2")));
+        remove(path.c_str());
+        assert(serialization::load(path, &loaded) != nullptr);
+    }
+
+    //Loaded basis starts over instead of resuming the interrupted computation of the previous one
+    void load_after_interrupt_test() {
+        Ideal<PMMR> ideal = {"a + b + c + d + e", "ab + bc + cd + de + ea", "abc + bcd + cde + dea + eab",
+                             "abcd + bcde + cdea + deab + eabc", "abcde - 1"};
+        stop_source stop;
+        ideal.set_stop_token(stop.get_token());
+        ideal.set_progress_handler([&stop](const Ideal<PMMR>::Progress& progress) {
+            if (progress.processed_pairs == 300) { stop.request_stop(); }
+        });
+        assert(ideal.make_groebner_basis() == ComputationStatus::Cancelled);
+        assert(ideal.get_buchberger_state().next_i > 2);
+        ideal.set_stop_token({});
+        ideal.reset_progress_handler();
+
+        stringstream stream;
+        serialization::write(stream, Ideal<PMMR>{"x^2 - y", "xy - 1"});
+        assert(serialization::read(stream, &ideal) == nullptr);
+        assert(ideal.get_buchberger_state().next_i == 0);
+        assert(ideal.make_reduced_groebner_basis() == ComputationStatus::Completed);
+        assert(ideal.is_basis_equals_to({"x^2 - y", "xy - 1", "y^2 - x"}));
+    }
+
+    void errors_test() {
+        auto read_error = [](const string& data) {
+            stringstream stream(data);
+            PMMR p;
+            return string(serialization::read(stream, &p));
+        };
+        stringstream stream;
+        serialization::write(stream, PMMR("x + y"));
+        string data = stream.str();
+        assert(read_error(data.substr(0, data.size() - 8)) == "Unexpected end of input");
+        assert(read_error("GBL?" + data.substr(4)) == "Not a serialized polynomial data");
+        stringstream other_field;
+        serialization::write(other_field, PM2R("x + y"));
+        assert(read_error(other_field.str()) == "Coefficient type doesn't match");
+        Ideal<PMMR> ideal;
+        stringstream polynomial_stream(data);
+        assert(string(serialization::read(polynomial_stream, &ideal)) == "Unexpected kind of serialized object");
+    }
+
+    template<typename T>
+    void patch(string* data, size_t offset, T value) {
+        memcpy(data->data() + offset, &value, sizeof(value));
+    }
+
+    template<typename Polynom>
+    string read_ideal_error(const string& data) {
+        stringstream stream(data);
+        Ideal<Polynom> ideal;
+        const char* error = serialization::read(stream, &ideal);
+        return error ? error : "";
+    }
+
+    template<typename Polynom>
+    string write_ideal(const Ideal<Polynom>& ideal) {
+        stringstream stream;
+        serialization::write(stream, ideal);
+        return stream.str();
+    }
+
+    //Coefficients of the same size are told apart by their type and the modulus of RuntimeMint
+    void coefficient_types_test() {
+        static_assert(sizeof(Integer<int64_t>) == sizeof(RuntimeMint<int64_t>));
+        static_assert(sizeof(Integer<int64_t>) == sizeof(Fraction<int32_t>));
+        RuntimeMint<int64_t>::set_modulus(1000003);
+        const string integer_data = write_ideal(Ideal<PI>{"2x + 3"});
+        const string runtime_data = write_ideal(Ideal<PR>{"2x + 3"});
+        const string fraction_data = write_ideal(Ideal<PF32>{"\\frac{2}{3}x + 3"});
+        assert(read_ideal_error<PR>(integer_data) == "Coefficient type doesn't match");
+        assert(read_ideal_error<PF32>(integer_data) == "Coefficient type doesn't match");
+        assert(read_ideal_error<PI>(runtime_data) == "Coefficient type doesn't match");
+        assert(read_ideal_error<PI>(fraction_data) == "Coefficient type doesn't match");
+        assert(read_ideal_error<PR>(fraction_data) == "Coefficient type doesn't match");
+        assert(read_ideal_error<PI>(integer_data).empty());
+        assert(read_ideal_error<PF32>(fraction_data).empty());
+        assert(read_ideal_error<PR>(runtime_data).empty());
+        RuntimeMint<int64_t>::set_modulus(1000033);
+        assert(read_ideal_error<PR>(runtime_data) == "Coefficient type doesn't match");
+        RuntimeMint<int64_t>::set_modulus(1000003);
+        assert(read_ideal_error<PR>(runtime_data).empty());
+    }
+
+    //Corrupted data must be rejected without asserts or allocations sized by the header
+    void corrupted_data_test() {
+        using serialization::Header;
+        stringstream stream;
+        serialization::write(stream, Ideal<PMMR>{"x + y"});
+        const string data = stream.str();
+        Header header;
+        memcpy(&header, data.data(), sizeof(header));
+        serialization::Layout layout(header);
+
+        string corrupted = data;
+        patch(&corrupted, offsetof(Header, polynomials_count), UINT64_MAX);
+        assert(read_ideal_error<PMMR>(corrupted) == "Bad sizes");
+        corrupted = data;
+        patch(&corrupted, offsetof(Header, terms_count), UINT64_MAX / 4);
+        assert(read_ideal_error<PMMR>(corrupted) == "Bad sizes");
+        corrupted = data;
+        patch(&corrupted, offsetof(Header, variables_count), UINT32_MAX);
+        assert(read_ideal_error<PMMR>(corrupted) == "Unexpected end of input");
+        corrupted = data;
+        patch(&corrupted, layout.offsets + sizeof(uint64_t), uint64_t(3));
+        assert(read_ideal_error<PMMR>(corrupted) == "Bad offsets");
+
+        for (int64_t value : {int64_t(0), int64_t(998244353), int64_t(-1)}) {
+            corrupted = data;
+            patch(&corrupted, layout.coefficients, value);
+            assert(read_ideal_error<PMMR>(corrupted) == "Bad coefficient");
+        }
+        //Both terms get the same monomial
+        corrupted = data;
+        corrupted.replace(layout.exponents, 2 * sizeof(uint32_t), data, layout.exponents + 2 * sizeof(uint32_t),
+                          2 * sizeof(uint32_t));
+        assert(read_ideal_error<PMMR>(corrupted) == "Bad terms");
+        vector<uint64_t> aligned(corrupted.size() / sizeof(uint64_t));
+        memcpy(aligned.data(), corrupted.data(), corrupted.size());
+        serialization::View<PMMR> view(string_view(reinterpret_cast<const char*>(aligned.data()), corrupted.size()),
+                                       serialization::Kind::Ideal);
+        PMMR p;
+        assert(view.get_error() == nullptr && string(view.get_polynomial(0, &p)) == "Bad terms");
+
+        stringstream fraction_stream;
+        serialization::write(fraction_stream, Ideal<PMFG>{"\\frac{1}{2}x"});
+        const string fraction_data = fraction_stream.str();
+        memcpy(&header, fraction_data.data(), sizeof(header));
+        size_t coefficients = serialization::Layout(header).coefficients;
+        for (auto [numerator, denominator] : {pair<int64_t, int64_t>{2, 4}, {1, -2}, {1, 0}, {0, 1}}) {
+            corrupted = fraction_data;
+            patch(&corrupted, coefficients, numerator);
+            patch(&corrupted, coefficients + sizeof(int64_t), denominator);
+            assert(read_ideal_error<PMFG>(corrupted) == "Bad coefficient");
+        }
+        assert(read_ideal_error<PMFG>(fraction_data).empty());
+    }
+}// namespace
+
+int main() {
+    polynomial_test();
+    ideal_test();
+    file_test();
+    load_after_interrupt_test();
+    coefficient_types_test();
+    errors_test();
+    corrupted_data_test();
+    cout << "OK" << endl;
+}
@@ -0,0 +1,68 @@
+#define GROEBNER_STATISTICS
+#include "../Library/Ideal.h"
+#include <sstream>
+using namespace std;
+
+using M = Mint<int64_t, 998244353>;
+using MM = Monomial<M, VariableOrders::InverseAsciiOrder>;
+using PMMR = Polynomial<MM, MonomialOrders::Grevlex>;
+
+namespace {
+    void counters_test() {
+        Ideal<PMMR> ideal = {"a + b + c + d", "ab + bc + cd + da", "abc + bcd + cda + dab", "abcd - 1"};
+        ideal.make_reduced_groebner_basis();
+        const auto& statistics = ideal.get_statistics();
+        const auto& buchberger_statistics = ideal.get_buchberger_state().statistics;
+        assert(statistics.pairs_generated == buchberger_statistics.processed_pairs);
+        assert(statistics.coprime_pairs == buchberger_statistics.coprime_pairs);
+        assert(statistics.zero_reductions == buchberger_statistics.zero_reductions);
+        assert(statistics.reduction_steps > statistics.pairs_generated - statistics.coprime_pairs);
+        assert(statistics.max_basis_size >= 4 && statistics.max_basis_size > ideal.size());
+        assert(statistics.s_polynomial_terms > statistics.remainder_terms);
+        assert(statistics.phases[instrumentation::GroebnerBasis].calls == 1);
+        assert(statistics.phases[instrumentation::ExcludeUnnecessary].calls == 1);
+        assert(statistics.phases[instrumentation::ReduceEach].calls == 1);
+        assert(statistics.phases[instrumentation::Reduction].calls >=
+               statistics.pairs_generated - statistics.coprime_pairs + ideal.size());
+        assert(statistics.phases[instrumentation::GroebnerBasis].total.count() > 0);
+        ideal.reset_statistics();
+        assert(ideal.get_statistics().pairs_generated == 0 && ideal.get_statistics().trace.empty());
+    }
+
+    void export_test() {
+        Ideal<PMMR> ideal = {"x^2 + y^2 - 1", "xy - 2"};
+        ideal.make_reduced_groebner_basis();
+        const auto& statistics = ideal.get_statistics();
+        ostringstream json;
+        statistics.write_json(json);
+        assert(json.str().find("\"pairs_generated\": " + to_string(statistics.pairs_generated)) != string::npos);
+        assert(json.str().find("\"reduce_each\": {\"calls\": 1") != string::npos);
+        ostringstream trace;
+        statistics.write_chrome_trace(trace);
+        assert(trace.str().starts_with("{\"traceEvents\": [") && trace.str().ends_with("}"));
+        size_t events = 0;
+        for (size_t pos = 0; (pos = trace.str().find("\"ph\": \"X\"", pos)) != string::npos; ++pos) { ++events; }
+        assert(events == statistics.trace.size());
+        //Nested phases are recorded when they finish, so the last event is the outermost one
+        const auto& last = statistics.trace.back();
+        assert(last.phase == instrumentation::ReduceEach);
+        const auto& inner = statistics.trace[statistics.trace.size() - 2];
+        assert(inner.phase == instrumentation::Reduction);
+        assert(last.start <= inner.start && inner.start + inner.duration <= last.start + last.duration);
+    }
+
+    void disabled_recorder_test() {
+        static_assert(is_empty_v<instrumentation::Recorder<false>>);
+        instrumentation::Recorder<false> recorder;
+        recorder.count_pair();
+        [[maybe_unused]] auto timer = recorder.time(instrumentation::Reduction);
+        assert(recorder.get().pairs_generated == 0);
+    }
+}// namespace
+
+int main() {
+    counters_test();
+    export_test();
+    disabled_recorder_test();
+    cout << "OK" << endl;
+}
@@ -0,0 +1,78 @@
+#include "../Parsers/SystemParser.h"
+#include <cstdio>
+#include <fstream>
+using namespace std;
+
+using F = Fraction<int64_t>;
+using MF = Monomial<F, VariableOrders::InverseAsciiOrder>;
+using PMFG = Polynomial<MF, MonomialOrders::Grlex>;
+using M = Mint<int64_t, 998244353>;
+using MM = Monomial<M, VariableOrders::InverseAsciiOrder>;
+using PMMR = Polynomial<MM, MonomialOrders::Grevlex>;
+
+namespace {
+    void polynomial_parse_test() {
+        string s = "3x^2y - \\frac{-1}{2}z_1 + 4 - x^2y\n";
+        size_t pos = 0;
+        PMFG p;
+        assert(PMFG::parse(s, &pos, &p) == nullptr);
+        assert(pos == s.size() - 1);
+        assert(p == PMFG("2x^2y + \\frac{1}{2}z_1 + 4"));
+        assert(PMFG(" - x ^2") == PMFG("-x^2"));
+        assert(PMFG("x - x").is_zero());
+        assert(PMMR("998244354x + 5") == PMMR("x + 5"));
+    }
+
+    void system_parse_test() {
+        string text = "x^2 + y^2 - 1\n"
+                      "\n"
+                      "  xy - \\frac{1}{4}\r\n"
+                      "x - y";
+        Ideal<PMFG> ideal;
+        assert(!SystemParser<PMFG>().parse(text, &ideal));
+        Ideal<PMFG> expected = {"x^2 + y^2 - 1", "xy - \\frac{1}{4}", "x - y"};
+        assert(ideal.get_basis() == expected.get_basis());
+        ideal.make_reduced_groebner_basis();
+        expected.make_reduced_groebner_basis();
+        assert(ideal.get_basis() == expected.get_basis());
+    }
+
+    void errors_test() {
+        auto check = [](string_view text, size_t line, size_t column, string_view message) {
+            vector<PMFG> polynomials;
+            auto error = SystemParser<PMFG>().parse(text, &polynomials);
+            assert(error && error->line == line && error->column == column && error->message == message);
+        };
+        check("x + y\nx + * y", 2, 5, "Expected coefficient or variable");
+        check("x^ + 1", 1, 4, "Expected digit");
+        check("x^2 + \\frac{1}{0}y", 1, 16, "Fraction can't have a zero denominator");
+        check("xy\n\n2x - \\fra{1}{2}", 3, 6, "Expected fraction in form \\frac{numerator}{denominator}");
+        check("2x, 3y", 1, 3, "Unexpected character");
+        check("x -", 1, 4, "Expected coefficient or variable");
+        //Bytes of UTF-8 letters are negative chars
+        check("x + \xCE\xB1y", 1, 5, "Expected coefficient or variable");
+    }
+
+    void file_test() {
+        string path = "system_parser_test.txt";
+        {
+            ofstream out(path);
+            for (int i = 1; i <= 100; ++i) { out << "x^" << i << " - " << i << "y + z_" << i << '\n'; }
+        }
+        vector<PMMR> polynomials;
+        assert(!SystemParser<PMMR>().parse_file(path, &polynomials));
+        assert(polynomials.size() == 100);
+        assert(polynomials[41] == PMMR("x^42 - 42y + z_42"));
+        remove(path.c_str());
+        auto error = SystemParser<PMMR>().parse_file(path, &polynomials);
+        assert(error && error->line == 0);
+    }
+}// namespace
+
+int main() {
+    polynomial_parse_test();
+    system_parse_test();
+    errors_test();
+    file_test();
+    cout << "OK" << endl;
+}
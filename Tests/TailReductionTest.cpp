@@ -0,0 +1,61 @@
+#include "../Library/Ideal.h"
+#include "../Library/PackedMonomial.h"
+using namespace std;
+
+using M = Mint<int64_t, 998244353>;
+using MM = Monomial<M, VariableOrders::InverseAsciiOrder>;
+using PR = Polynomial<MM, MonomialOrders::Grevlex>;
+using PL = Polynomial<MM, MonomialOrders::Lex>;
+using PF = Polynomial<Monomial<Fraction<int64_t>, VariableOrders::InverseAsciiOrder>, MonomialOrders::Grlex>;
+using PP = Polynomial<PackedMonomial<M, 5, uint8_t, PackedLayout::Grevlex>, MonomialOrders::Grevlex>;
+using PI = Polynomial<Monomial<Integer<int64_t>, VariableOrders::InverseAsciiOrder>, MonomialOrders::Grevlex>;
+
+namespace {
+    void top_reduction_test() {
+        PR p("x^2 + y"), q("x^3 + xy + y^2 + x");
+        //Only the leading term is cancelled, y^2 would be reduced by a full reduction too
+        assert(p.do_one_top_reduction_over(q) && q == PR("y^2 + x"));
+        assert(!p.do_one_top_reduction_over(q) && q == PR("y^2 + x"));
+        PR r("y^3 + x^2");
+        assert(!p.do_one_top_reduction_over(r));
+        assert(p.do_one_elementary_reduction_over(r) && r == PR("y^3 - y"));
+    }
+
+    template<typename Polynom>
+    void compare_with_full_reduction(const vector<string>& generators) {
+        Ideal<Polynom> full, lazy;
+        lazy.set_lazy_tail_reduction(true);
+        for (const auto& s : generators) {
+            full.insert(s);
+            lazy.insert(s);
+        }
+        full.make_reduced_groebner_basis();
+        assert(lazy.make_reduced_groebner_basis() == ComputationStatus::Completed);
+        assert(lazy.size() == full.size());
+        for (const auto& p : full.get_basis()) { assert(lazy.basis_contains(p)); }
+    }
+
+    void ideal_test() {
+        vector<string> cyclic = {"x_1 + x_2 + x_3 + x_4", "x_1x_2 + x_2x_3 + x_3x_4 + x_4x_1",
+                                 "x_1x_2x_3 + x_2x_3x_4 + x_3x_4x_1 + x_4x_1x_2", "x_1x_2x_3x_4 - 1"};
+        vector<string> katsura = {"x_1 + 2x_2 + 2x_3 - 1", "x_1^2 + 2x_2^2 + 2x_3^2 - x_1", "2x_1x_2 + 2x_2x_3 - x_2"};
+        compare_with_full_reduction<PR>(cyclic);
+        compare_with_full_reduction<PR>(katsura);
+        compare_with_full_reduction<PL>(cyclic);
+        compare_with_full_reduction<PL>(katsura);
+        compare_with_full_reduction<PF>(katsura);
+        compare_with_full_reduction<PP>(cyclic);
+        compare_with_full_reduction<PR>({"x^3 - 2xy", "x^2y - 2y^2 + x"});
+
+        //Ignored over the integers
+        Ideal<PI> integral;
+        integral.set_lazy_tail_reduction(true);
+        assert(!integral.is_lazy_tail_reduction());
+    }
+}// namespace
+
+int main() {
+    top_reduction_test();
+    ideal_test();
+    cout << "OK" << endl;
+}
@@ -0,0 +1,22 @@
+#pragma once
+#include "../Benchmarks/Systems.h"
+#include "../Library/Ideal.h"
+#include <algorithm>
+
+//Helpers of tests that compare bases computed in different ways
+namespace tests {
+    template<typename Polynom>
+    Ideal<Polynom> make_ideal(const std::vector<std::string>& generators) {
+        Ideal<Polynom> ideal;
+        for (const auto& s : generators) { ideal.insert(s); }
+        return ideal;
+    }
+
+    //Reduced bases are equal as sets, the order of polynomials depends on the computation
+    template<typename Polynom>
+    bool are_same_bases(const Ideal<Polynom>& lhs, const Ideal<Polynom>& rhs) {
+        if (lhs.size() != rhs.size()) { return false; }
+        return std::all_of(lhs.get_basis().begin(), lhs.get_basis().end(),
+                           [&rhs](const auto& p) { return rhs.basis_contains(p); });
+    }
+}// namespace tests
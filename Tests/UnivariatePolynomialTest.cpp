@@ -0,0 +1,77 @@
+#include "../Library/UnivariatePolynomial.h"
+#include <sstream>
+using namespace std;
+
+using M = Mint<int64_t, 998244353>;
+using UP = UnivariatePolynomial<M>;
+using MM = Monomial<M, VariableOrders::InverseAsciiOrder>;
+using PMM = Polynomial<MM, MonomialOrders::Grlex>;
+
+namespace {
+    UP random_polynomial(size_t size, mt19937& rng) {
+        uniform_int_distribution<int64_t> gen(0, M::get_modulus() - 1);
+        vector<M> coefficients(size);
+        for (auto& c : coefficients) { c = gen(rng); }
+        if (size) { coefficients.back() = 1; }
+        return UP(coefficients);
+    }
+
+    void arithmetic_test() {
+        mt19937 rng(777);
+        uniform_int_distribution<int64_t> gen(0, M::get_modulus() - 1);
+        for (size_t size : {1, 10, 63, 64, 100, 1000, 3000}) {
+            UP a = random_polynomial(size, rng), b = random_polynomial(size / 2 + 1, rng);
+            UP product = a * b;
+            assert(product.get_degree() == a.get_degree() + b.get_degree());
+            for (int i = 0; i < 5; ++i) {
+                M x = gen(rng);
+                assert(product.evaluate(x) == a.evaluate(x) * b.evaluate(x));
+            }
+            UP c = random_polynomial(size / 3, rng);
+            auto [q, r] = divide(product + c, b);
+            assert(q == a && r == c);
+            auto [q1, r1] = divide(a, b);
+            assert(q1 * b + r1 == a);
+            assert(r1.is_zero() || r1.get_degree() < b.get_degree());
+            UP inverse = b.inverse_series(size);
+            UP one = b * inverse;
+            for (size_t i = 0; i < size; ++i) { assert(one[i] == (i == 0 ? 1 : 0)); }
+        }
+        UP a = random_polynomial(500, rng), b = random_polynomial(400, rng), d = random_polynomial(300, rng);
+        UP g = gcd(a * d, b * d);
+        assert(divide(g, d).second.is_zero());
+        assert(g.get_leading_coefficient() == 1);
+    }
+
+    void multipoint_test() {
+        mt19937 rng(777);
+        uniform_int_distribution<int64_t> gen(0, M::get_modulus() - 1);
+        UP p = random_polynomial(2000, rng);
+        vector<M> points(1500);
+        for (auto& x : points) { x = gen(rng); }
+        auto values = p.evaluate(points);
+        for (size_t i = 0; i < points.size(); ++i) { assert(values[i] == p.evaluate(points[i])); }
+        assert(p.evaluate(vector<M>()).empty());
+    }
+
+    void conversion_test() {
+        PMM p("3x^5 - x^2 + 7");
+        Variable<int32_t, VariableOrders::InverseAsciiOrder> var('a');
+        UP u = to_univariate(p, &var);
+        assert(u == UP(vector<M>({7, 0, -1, 0, 0, 3})));
+        assert((var == Variable<int32_t, VariableOrders::InverseAsciiOrder>('x')));
+        assert(from_univariate<PMM>(u, var) == p);
+        assert(to_univariate(PMM("5")) == UP(M(5)));
+        assert(from_univariate<PMM>(UP(), var).is_zero());
+        stringstream stream;
+        stream << u;
+        assert(stream.str() == "3x^5 + 998244352x^2 + 7");
+    }
+}// namespace
+
+int main() {
+    arithmetic_test();
+    multipoint_test();
+    conversion_test();
+    cout << "OK";
+}
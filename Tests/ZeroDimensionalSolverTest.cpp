@@ -0,0 +1,86 @@
+#include "../Library/ZeroDimensionalSolver.h"
+#include <sstream>
+using namespace std;
+
+using M = Mint<int64_t, 998244353>;
+using MM = Monomial<M, VariableOrders::InverseAsciiOrder>;
+using PMMR = Polynomial<MM, MonomialOrders::Grevlex>;
+using PMML = Polynomial<MM, MonomialOrders::Lex>;
+using Solver = ZeroDimensionalSolver<PMMR>;
+
+namespace {
+    template<typename Polynom>
+    M evaluate(const Polynom& p, const Solver::Solution& point) {
+        M res = 0;
+        for (const auto& m : p.get_monomials_ascending_order()) {
+            M value = m.get_coefficient();
+            for (const auto& [var, deg] : m.get_variables_ascending_order()) { value *= pow(point.at(var), deg); }
+            res += value;
+        }
+        return res;
+    }
+
+    PMML to_lex(const PMMR& p) {
+        stringstream stream;
+        stream << p;
+        return PMML(stream.str());
+    }
+
+    void check_solutions(const Ideal<PMMR>& ideal, size_t expected_count) {
+        Solver solver(ideal);
+        auto solutions = solver.solve();
+        assert(solutions.size() == expected_count);
+        for (const auto& solution : solutions) {
+            for (const auto& p : ideal.get_basis()) { assert(evaluate(p, solution) == 0); }
+        }
+        Ideal<PMML> lex;
+        for (const auto& p : ideal.get_basis()) { lex.insert(to_lex(p)); }
+        lex.make_reduced_groebner_basis();
+        assert(lex.size() == solver.get_lex_basis().size());
+        for (const auto& g : solver.get_lex_basis()) { assert(lex.basis_contains(g)); }
+    }
+}// namespace
+
+int main() {
+    check_solutions(Ideal<PMMR>{"x^2 - 3x + 2", "y - x - 1", "z^2 - 4"}, 4);
+    check_solutions(Ideal<PMMR>{"x^2 + y^2 - 5", "xy - 2"}, 4);
+    check_solutions(Ideal<PMMR>{"x^2 + 1", "y^2 - x"}, 4);
+    //Cube root is unique since 3 doesn't divide p - 1, the other two roots of x^3 - 2 lie in an extension
+    check_solutions(Ideal<PMMR>{"x^3 - 2", "y^2 - x"}, 2);
+    //3 is a quadratic non-residue
+    check_solutions(Ideal<PMMR>{"x^2 - 3", "y - x"}, 0);
+    check_solutions(Ideal<PMMR>{"x - 1", "x - 2"}, 0);
+    {
+        Solver line(Ideal<PMMR>{"x^2 - y"});
+        assert(line.get_error() != nullptr && line.get_lex_basis().empty() && line.solve().empty());
+    }
+    //Katsura-3
+    check_solutions(Ideal<PMMR>{"a + 2b + 2c - 1", "a^2 + 2b^2 + 2c^2 - a", "2ab + 2bc - b"}, 4);
+    {
+        //Roots are large field elements, brute force over the field is impossible
+        M a = 123456789, b = 987654321;
+        stringstream eliminant;
+        eliminant << "x^2 - " << a + b << "x + " << a * b;
+        Solver solver(Ideal<PMMR>{eliminant.str(), "y - 31337x - 271828"});
+        auto solutions = solver.solve();
+        assert(solutions.size() == 2);
+        for (const auto& solution : solutions) {
+            M x = solution.at(Variable<int32_t, VariableOrders::InverseAsciiOrder>('x'));
+            M y = solution.at(Variable<int32_t, VariableOrders::InverseAsciiOrder>('y'));
+            assert(x == a || x == b);
+            assert(y == M(31337) * x + M(271828));
+        }
+    }
+    {
+        using UP = UnivariatePolynomial<M>;
+        UP f = UP(vector<M>{-5, 1}) * UP(vector<M>{7, 1}) * UP(vector<M>{-3, 0, 1}) * UP(vector<M>{-5, 1});
+        assert(find_roots(f) == vector<M>({5, M(-7)}));
+        assert(find_roots(UnivariatePolynomial<M>(M(3))).empty());
+        using M2 = Mint<int64_t, 2>;
+        assert(find_roots(UnivariatePolynomial<M2>(vector<M2>{0, 1, 1})) == vector<M2>({0, 1}));
+        auto [q, r] = divide(f, UP(vector<M>{-5, 1}));
+        assert(r.is_zero() && q.get_degree() == 4);
+        assert(gcd(f, f.derivative()) == UP(vector<M>{-5, 1}));
+    }
+    cout << "OK";
+}